@@ -69,6 +69,10 @@ namespace GRINS
     virtual void read_bc_data( const GetPot& input, const std::string& id_str,
 			       const std::string& bc_str );
 
+    //! Change a scalar boundary condition parameter, see Physics::set_parameter
+    /*! By default, no parameters can be changed. */
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
     //! Override this method to initialize any system-dependent data.
     /*! Override this method to, for example, cache a System variable
         number. This is called before any of the other init methods in this class.
@@ -86,6 +90,10 @@ namespace GRINS
 					 const GRINS::BoundaryID bc_id,
 					 const GRINS::BCType bc_type ) const;
 
+    //! Register the side cached quantities read by the Neumann BCs
+    /*! Called after init_bc_data. By default, registers nothing. */
+    virtual void register_cache_quantities( std::set<unsigned int>& side_quantities ) const;
+
     virtual void init_dirichlet_bc_func_objs( libMesh::FEMSystem* system ) const;
 
     virtual void init_periodic_bcs( libMesh::FEMSystem* system ) const;
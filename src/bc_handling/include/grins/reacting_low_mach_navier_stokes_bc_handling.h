@@ -46,6 +46,11 @@ namespace GRINS
     virtual int string_to_int( const std::string& bc_type_in ) const;
 
     virtual void init_bc_data( const libMesh::FEMSystem& system );
+
+    //! The reactant catalycities gamma_<reactant>_<bc_id> can be changed
+    /*! The product wall uses the reactant catalycity, so changing the
+	product catalycity would have no effect and is not allowed. */
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
     
     virtual void init_bc_types( const GRINS::BoundaryID bc_id, 
 			       const std::string& bc_id_string, 
@@ -65,6 +70,9 @@ namespace GRINS
 					 const GRINS::BoundaryID bc_id,
 					 const GRINS::BCType bc_type ) const;
 
+    //! Catalytic walls need the gas state on the side
+    virtual void register_cache_quantities( std::set<unsigned int>& side_quantities ) const;
+
     void set_species_bc_type( GRINS::BoundaryID bc_id, int bc_type );
     void set_species_bc_values( GRINS::BoundaryID bc_id, const std::vector<libMesh::Real>& species_values );
     libMesh::Real get_species_bc_value( GRINS::BoundaryID bc_id, unsigned int species ) const;
@@ -85,6 +93,9 @@ namespace GRINS
     std::map<BoundaryID,std::vector<unsigned int> > _product_list;
     std::map<BoundaryID,std::map<unsigned int,libMesh::Real> > _catalycities;
 
+    //! Input name of each reactant catalycity, with its boundary and reaction index
+    std::map<std::string,std::pair<BoundaryID,unsigned int> > _catalycity_params;
+
     const Chemistry& _chemistry;
 
   private:
@@ -0,0 +1,65 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_ERROR_ESTIMATOR_FACTORY_H
+#define GRINS_ERROR_ESTIMATOR_FACTORY_H
+
+// C++
+#include <string>
+#include "boost/tr1/memory.hpp"
+
+// libMesh
+#include "libmesh/error_estimator.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace GRINS
+{
+  //! This object handles constructing the error estimator used for mesh adaptivity.
+  /*! Options are read from the mesh-adaptivity section. With a QoI, the
+      default for steady solves is the adjoint weighted residual estimate
+      of the QoI error, otherwise the Kelly estimate of the solution error. */
+  class ErrorEstimatorFactory
+  {
+  public:
+
+    ErrorEstimatorFactory();
+    virtual ~ErrorEstimatorFactory();
+
+    //! Builds the libMesh::ErrorEstimator
+    /*! Users should override this method to construct
+	their own error estimators. */
+    virtual std::tr1::shared_ptr<libMesh::ErrorEstimator> build( const GetPot& input );
+
+    //! Estimator type that build() will construct
+    static std::string estimator_type( const GetPot& input );
+
+  };
+} // namespace GRINS
+#endif // GRINS_ERROR_ESTIMATOR_FACTORY_H
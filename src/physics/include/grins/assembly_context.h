@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_ASSEMBLY_CONTEXT_H
+#define GRINS_ASSEMBLY_CONTEXT_H
+
+// C++
+#include <map>
+
+// GRINS
+#include "grins/cached_values.h"
+
+// libMesh
+#include "libmesh/fem_context.h"
+
+// Boost
+#include "boost/tr1/memory.hpp"
+#include <boost/scoped_ptr.hpp>
+
+namespace GRINS
+{
+  // GRINS forward declarations
+  class Physics;
+  class MultiphysicsSystem;
+
+  //! Base class for per-thread objects a Physics attaches to an AssemblyContext
+  class AssemblyContextData
+  {
+  public:
+
+    AssemblyContextData(){};
+    virtual ~AssemblyContextData(){};
+
+  };
+
+  //! Wraps an arbitrary object, e.g. a property evaluator, as AssemblyContextData
+  template<typename T>
+  class AssemblyContextObject : public AssemblyContextData
+  {
+  public:
+
+    //! Takes ownership of object
+    AssemblyContextObject( T* object )
+      : _object(object)
+    {};
+
+    virtual ~AssemblyContextObject(){};
+
+    T& get()
+    { return *_object; };
+
+  protected:
+
+    boost::scoped_ptr<T> _object;
+
+  };
+
+  //! FEMContext that also owns the CachedValues used during assembly
+  /*!
+    libMesh builds one context per assembly thread (through
+    MultiphysicsSystem::build_context) and reuses it for every element
+    that thread visits. Keeping the CachedValues here lets each thread
+    reuse the cache storage across elements instead of constructing a
+    new cache for each one. Element interiors and sides use separate
+    caches, since physics and BC handlers need different quantities on
+    each.
+   */
+  class AssemblyContext : public libMesh::FEMContext
+  {
+  public:
+
+    AssemblyContext( const libMesh::System& system );
+    virtual ~AssemblyContext();
+
+    //! Per-thread cache. Callers should clear() it before each element.
+    CachedValues& get_cached_values();
+
+    //! Per-thread cache for sides. Callers should clear() it before each side.
+    CachedValues& get_side_cached_values();
+
+    //! Track cache reads and report unread quantities to system on destruction
+    void report_unread_cache_to( MultiphysicsSystem* system );
+
+    //! Subdomain whose quantities are active in the caches
+    /*! Elem::invalid_subdomain_id until set_cache_subdomain() is called,
+	see MultiphysicsSystem::activate_cache_quantities(). */
+    libMesh::subdomain_id_type cache_subdomain() const;
+
+    void set_cache_subdomain( libMesh::subdomain_id_type subdomain_id );
+
+    //! Attach per-thread data for physics, typically from Physics::init_context
+    /*! The context takes ownership of data and deletes it when destroyed. */
+    void set_physics_data( const Physics* physics, AssemblyContextData* data );
+
+    //! Data attached for physics, or NULL if there is none
+    AssemblyContextData* get_physics_data( const Physics* physics ) const;
+
+  protected:
+
+    CachedValues _cached_values;
+
+    CachedValues _side_cached_values;
+
+    MultiphysicsSystem* _unread_cache_system;
+
+    libMesh::subdomain_id_type _cache_subdomain;
+
+    std::map<const Physics*, std::tr1::shared_ptr<AssemblyContextData> > _physics_data;
+
+  };
+
+  inline
+  CachedValues& AssemblyContext::get_cached_values()
+  {
+    return _cached_values;
+  }
+
+  inline
+  CachedValues& AssemblyContext::get_side_cached_values()
+  {
+    return _side_cached_values;
+  }
+
+  inline
+  libMesh::subdomain_id_type AssemblyContext::cache_subdomain() const
+  {
+    return _cache_subdomain;
+  }
+
+  inline
+  void AssemblyContext::set_cache_subdomain( libMesh::subdomain_id_type subdomain_id )
+  {
+    _cache_subdomain = subdomain_id;
+  }
+
+  inline
+  AssemblyContextData* AssemblyContext::get_physics_data( const Physics* physics ) const
+  {
+    std::map<const Physics*, std::tr1::shared_ptr<AssemblyContextData> >::const_iterator it =
+      _physics_data.find(physics);
+
+    return ( it == _physics_data.end() ) ? NULL : it->second.get();
+  }
+
+} // namespace GRINS
+
+#endif // GRINS_ASSEMBLY_CONTEXT_H
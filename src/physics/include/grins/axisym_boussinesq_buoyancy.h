@@ -71,6 +71,9 @@ namespace GRINS
     //! Read options from GetPot input file.
     virtual void read_input_options( const GetPot& input );
 
+    //! rho_ref, T_ref and beta_T can be changed
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
     //! Initialization of AxisymmetricBoussinesqBuoyancy variables
     virtual void init_variables( libMesh::FEMSystem* system );
 
@@ -65,6 +65,8 @@ namespace GRINS
     //! Sets velocity variables to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    virtual void owned_variables( std::set<VariableIndex>& vars ) const;
+
     // Context initialization
     virtual void init_context( libMesh::FEMContext& context );
 
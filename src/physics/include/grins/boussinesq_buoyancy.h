@@ -61,6 +61,9 @@ namespace GRINS
 
     ~BoussinesqBuoyancy();
 
+    //! rho_ref, T_ref and beta_T can be changed
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
     //! Initialization of BoussinesqBuoyancy variables
     virtual void init_variables( libMesh::FEMSystem* system );
 
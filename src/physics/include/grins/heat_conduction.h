@@ -46,6 +46,8 @@ namespace GRINS
 
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    virtual void owned_variables( std::set<VariableIndex>& vars ) const;
+
     //! Initialize context for added physics variables
     virtual void init_context( libMesh::FEMContext& context );
 
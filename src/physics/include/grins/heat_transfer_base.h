@@ -54,6 +54,9 @@ namespace GRINS
     //! Read options from GetPot input file.
     virtual void read_input_options( const GetPot& input );
 
+    //! rho, Cp and k can be changed
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
     //! Initialization Heat Transfer variables
     /*!
       Add velocity and pressure variables to system.
@@ -63,6 +66,8 @@ namespace GRINS
     //! Sets velocity variables to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    virtual void owned_variables( std::set<VariableIndex>& vars ) const;
+
     // Context initialization
     virtual void init_context( libMesh::FEMContext& context );
 
@@ -68,6 +68,31 @@ namespace GRINS
 			       libMesh::Gradient U,
 			       bool is_steady ) const;
 
+    //! Variation of compute_tau_continuity() given the variation of tau_M
+    libMesh::Real compute_tau_continuity_deriv( libMesh::Real tau_C,
+						libMesh::Real tau_M,
+						libMesh::Real dtau_M ) const;
+
+    //! Variation of compute_tau_momentum() given variations of rho, U and mu
+    libMesh::Real compute_tau_momentum_deriv( libMesh::FEMContext& c,
+					      unsigned int qp,
+					      libMesh::Real tau_M,
+					      libMesh::RealTensor& G,
+					      libMesh::Real rho, libMesh::Real drho,
+					      libMesh::Gradient U, libMesh::Gradient dU,
+					      libMesh::Real mu, libMesh::Real dmu,
+					      bool is_steady ) const;
+
+    //! Variation of compute_tau() given variations of its arguments
+    libMesh::Real compute_tau_deriv( libMesh::FEMContext& c,
+				     unsigned int qp,
+				     libMesh::Real tau,
+				     libMesh::Real mat_prop_sq, libMesh::Real dmat_prop_sq,
+				     libMesh::RealTensor& G,
+				     libMesh::Real rho, libMesh::Real drho,
+				     libMesh::Gradient U, libMesh::Gradient dU,
+				     bool is_steady ) const;
+
     /*! \todo Should we inline this? */
     libMesh::RealGradient UdotGradU( libMesh::Gradient& U, libMesh::Gradient& grad_u, 
 				     libMesh::Gradient& grad_v ) const;
@@ -142,6 +167,55 @@ namespace GRINS
 
     return this->_tau_factor/std::sqrt(tau);
   }
+
+  inline
+  libMesh::Real IncompressibleNavierStokesStabilizationHelper::compute_tau_continuity_deriv( libMesh::Real tau_C,
+											     libMesh::Real tau_M,
+											     libMesh::Real dtau_M ) const
+  {
+    return -tau_C*dtau_M/tau_M;
+  }
+
+  inline
+  libMesh::Real IncompressibleNavierStokesStabilizationHelper::compute_tau_momentum_deriv( libMesh::FEMContext& c,
+											   unsigned int qp,
+											   libMesh::Real tau_M,
+											   libMesh::RealTensor& G,
+											   libMesh::Real rho, libMesh::Real drho,
+											   libMesh::Gradient U, libMesh::Gradient dU,
+											   libMesh::Real mu, libMesh::Real dmu,
+											   bool is_steady ) const
+  {
+    return this->compute_tau_deriv( c, qp, tau_M, mu*mu, 2.0*mu*dmu, G, rho, drho, U, dU, is_steady );
+  }
+
+  inline
+  libMesh::Real IncompressibleNavierStokesStabilizationHelper::compute_tau_deriv( libMesh::FEMContext& c,
+										  unsigned int /*qp*/,
+										  libMesh::Real tau,
+										  libMesh::Real /*mat_prop_sq*/,
+										  libMesh::Real dmat_prop_sq,
+										  libMesh::RealTensor& G,
+										  libMesh::Real rho, libMesh::Real drho,
+										  libMesh::Gradient U, libMesh::Gradient dU,
+										  bool is_steady ) const
+  {
+    libMesh::Gradient rhoU = rho*U;
+    libMesh::Gradient drhoU = drho*U + rho*dU;
+
+    libMesh::Real dtau = rhoU*(G*drhoU) + drhoU*(G*rhoU) + this->_C*dmat_prop_sq*G.contract(G);
+
+    if(!is_steady)
+      {
+	const libMesh::Real two_over_dt = 2.0/c.get_deltat_value();
+	dtau += 2.0*(two_over_dt*rho)*(two_over_dt*drho);
+      }
+
+    // tau = tau_factor/sqrt(A), so dtau = -tau/(2A) dA with A = (tau_factor/tau)^2
+    const libMesh::Real A = (this->_tau_factor/tau)*(this->_tau_factor/tau);
+
+    return -0.5*tau*dtau/A;
+  }
   
 }
 #endif // GRINS_INC_NAVIER_STOKES_STAB_HELPER_H
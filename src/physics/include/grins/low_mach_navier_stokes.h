@@ -76,6 +76,12 @@ namespace GRINS
 					const std::vector<libMesh::Point>& points,
 					CachedValues& cache );
 
+    virtual void register_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
+    virtual void provided_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
   protected:
 
     //! Enable pressure pinning
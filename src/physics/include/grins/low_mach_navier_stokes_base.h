@@ -62,6 +62,8 @@ namespace GRINS
     //! Sets velocity variables to be time-evolving
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    virtual void owned_variables( std::set<VariableIndex>& vars ) const;
+
     // Context initialization
     virtual void init_context( libMesh::FEMContext& context );
 
@@ -69,6 +71,10 @@ namespace GRINS
 
     libMesh::Real rho( libMesh::Real T, libMesh::Real p0 ) const;
 
+    //! Variation of rho given variations of T and p0
+    libMesh::Real rho_deriv( libMesh::Real T, libMesh::Real p0,
+                             libMesh::Real dT, libMesh::Real dp0 ) const;
+
     libMesh::Real get_p0_steady( const libMesh::FEMContext& c, unsigned int qp ) const;
 
     libMesh::Real get_p0_steady_side( const libMesh::FEMContext& c, unsigned int qp ) const;
@@ -138,6 +144,14 @@ namespace GRINS
   {
     return p0/(this->_R*T);
   }
+
+  template<class V, class SH, class TC>
+  inline
+  libMesh::Real LowMachNavierStokesBase<V,SH,TC>::rho_deriv( libMesh::Real T, libMesh::Real p0,
+                                                             libMesh::Real dT, libMesh::Real dp0 ) const
+  {
+    return this->rho(T,p0)*( dp0/p0 - dT/T );
+  }
   
   template<class V, class SH, class TC>
   inline 
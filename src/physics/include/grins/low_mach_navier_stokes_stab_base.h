@@ -69,6 +69,51 @@ namespace GRINS
 
   protected:
 
+    //! Solution data at a quadrature point entering the stabilization terms
+    /*! The same structure holds the variation of that data along a single
+        element degree of freedom, which is how the stabilization Jacobians
+        are built. Values read through fixed_interior_* and interior_* are
+        kept apart since they depend on the solution with different weights. */
+    struct PointState
+    {
+      // Through fixed_interior_*
+      libMesh::Real T, p0;
+      libMesh::RealGradient U, grad_T, grad_p;
+      libMesh::RealGradient grad_u[3];
+      libMesh::RealTensor hess_T;
+      libMesh::RealTensor hess_u[3];
+
+      // Through interior_*; these are the time derivatives in mass_residual
+      libMesh::Real T_elem, p0_elem;
+      libMesh::RealGradient U_elem, grad_T_elem;
+      libMesh::RealGradient grad_u_elem[3];
+    };
+
+    //! Variables whose dofs the stabilization terms depend on
+    void jacobian_variables( std::vector<VariableIndex>& vars ) const;
+
+    void get_point_state( libMesh::FEMContext& context, unsigned int qp,
+			  PointState& state ) const;
+
+    //! Variation of the point state along dof j of variable var
+    void get_point_variation( libMesh::FEMContext& context, unsigned int qp,
+			      VariableIndex var, unsigned int j,
+			      PointState& dstate ) const;
+
+    /*! \todo The variations of the strong residuals neglect second derivatives
+               of the property models, which vanish for the constant models. */
+    libMesh::Real compute_res_continuity_steady_deriv( const PointState& s, const PointState& ds ) const;
+
+    libMesh::Real compute_res_continuity_transient_deriv( const PointState& s, const PointState& ds ) const;
+
+    libMesh::RealGradient compute_res_momentum_steady_deriv( const PointState& s, const PointState& ds ) const;
+
+    libMesh::RealGradient compute_res_momentum_transient_deriv( const PointState& s, const PointState& ds ) const;
+
+    libMesh::Real compute_res_energy_steady_deriv( const PointState& s, const PointState& ds ) const;
+
+    libMesh::Real compute_res_energy_transient_deriv( const PointState& s, const PointState& ds ) const;
+
     LowMachNavierStokesStabilizationHelper _stab_helper;
     
   private:
@@ -51,6 +51,27 @@ namespace GRINS
 				      libMesh::Real cp,
 				      bool is_steady ) const;
 
+    //! Variation of compute_tau_energy() given variations of its arguments
+    libMesh::Real compute_tau_energy_deriv( libMesh::FEMContext& c,
+					    unsigned int qp,
+					    libMesh::Real tau_E,
+					    libMesh::RealTensor& G,
+					    libMesh::Real rho, libMesh::Real drho,
+					    libMesh::Gradient U, libMesh::Gradient dU,
+					    libMesh::Real k, libMesh::Real dk,
+					    libMesh::Real cp, libMesh::Real dcp,
+					    bool is_steady ) const;
+
+    //! grad(T).(grad U)^T, the transposed part of mu'(T) grad(T).(grad U + (grad U)^T)
+    libMesh::RealGradient gradT_GradU_T( const libMesh::Gradient& grad_T,
+					 const libMesh::Gradient& grad_u,
+					 const libMesh::Gradient& grad_v ) const;
+
+    libMesh::RealGradient gradT_GradU_T( const libMesh::Gradient& grad_T,
+					 const libMesh::Gradient& grad_u,
+					 const libMesh::Gradient& grad_v,
+					 const libMesh::Gradient& grad_w ) const;
+
   }; // class LowMachNavierStokesStabilizationHelper
 
   /* ------------- Inline Functions ---------------*/
@@ -75,6 +96,21 @@ namespace GRINS
     */
     return this->compute_tau( c, qp, k*k, g, G, rho*cp, U, is_steady );
   }
+
+  inline
+  libMesh::Real LowMachNavierStokesStabilizationHelper::compute_tau_energy_deriv( libMesh::FEMContext& c,
+										  unsigned int qp,
+										  libMesh::Real tau_E,
+										  libMesh::RealTensor& G,
+										  libMesh::Real rho, libMesh::Real drho,
+										  libMesh::Gradient U, libMesh::Gradient dU,
+										  libMesh::Real k, libMesh::Real dk,
+										  libMesh::Real cp, libMesh::Real dcp,
+										  bool is_steady ) const
+  {
+    return this->compute_tau_deriv( c, qp, tau_E, k*k, 2.0*k*dk, G,
+				    rho*cp, drho*cp + rho*dcp, U, dU, is_steady );
+  }
   
 }
 #endif // LOW_MACH_NAVIER_STOKES_STAB_HELPER_H
@@ -30,7 +30,11 @@
 #define GRINS_MULTIPHYSICS_SYS_H
 
 // C++
+#include <iostream>
+#include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 // GRINS
 #include "grins_config.h"
@@ -38,6 +42,9 @@
 
 // libMesh
 #include "libmesh/fem_system.h"
+#include "libmesh/elem.h"
+#include "libmesh/threads.h"
+#include "libmesh/numeric_vector.h"
 
 #ifdef GRINS_HAVE_GRVY
 // GRVY timers
@@ -51,10 +58,15 @@ namespace libMesh
 {
   class EquationSystems;
   class DiffContext;
+  template <typename T> class LinearSolver;
 }
 
 namespace GRINS
 {
+  // Forward declarations
+  class QoIBase;
+  class AssemblyContext;
+
   //! Interface with libMesh for solving Multiphysics problems.
   /*!
     MultiphysicsSystem (through libMesh::FEMSystem) solves the following equation:
@@ -100,6 +112,9 @@ namespace GRINS
     //! System initialization. Calls each physics implementation of init_variables()
     virtual void init_data();
 
+    //! Builds an AssemblyContext, which carries the per-thread CachedValues
+    virtual libMesh::AutoPtr<libMesh::DiffContext> build_context();
+
     //! Context initialization. Calls each physics implementation of init_context()
     virtual void init_context( libMesh::DiffContext &context );
 
@@ -129,6 +144,11 @@ namespace GRINS
     //! Query to check if a particular physics has been enabled
     bool has_physics( const std::string physics_name ) const;
 
+    //! Add the variables the named physics own to vars, see Physics::owned_variables
+    /*! An empty set of names means every physics. */
+    void owned_variables( const std::set<PhysicsName>& physics_names,
+			  std::set<VariableIndex>& vars ) const;
+
     std::tr1::shared_ptr<GRINS::Physics> get_physics( const std::string physics_name );
 
     std::tr1::shared_ptr<GRINS::Physics> get_physics( const std::string physics_name ) const;
@@ -137,6 +157,118 @@ namespace GRINS
 				const std::vector<libMesh::Point>& points,
 				CachedValues& cache ) const;
 
+    //! Whether any physics advances part of its equations outside the global solve
+    bool has_split_time_step() const;
+
+    //! Advance the operator split part of every physics over deltat
+    /*! See Physics::split_time_step. current_local_solution is updated
+	once all the physics are done. */
+    void split_time_step( libMesh::Real deltat );
+
+    //! Change a scalar input parameter in every physics that uses it
+    /*! See Physics::set_parameter. Returns false if no physics uses
+	the parameter. The Jacobian is rebuilt at the next solve. */
+    bool set_parameter( const std::string& param_name, libMesh::Real value );
+
+    //! Assemble only the named physics, e.g. for one stage of a staged solve
+    /*! The other physics stay in the physics list, with their variables
+	and boundary conditions, but contribute nothing to the residual.
+	Variables no active physics assembles must be frozen with
+	set_frozen_variables(). An empty set activates every physics. */
+    void set_active_physics( const std::set<PhysicsName>& physics_names );
+
+    //! Activate the cached quantities the QoI registers, see QoIBase::register_cache_quantities
+    /*! Should be called with the QoI passed to attach_qoi(). */
+    void register_qoi_cache_quantities( const QoIBase& qoi );
+
+    //! Hold variables at their current values in later solves
+    /*! The residual rows of their dofs are replaced by u - u_frozen and
+	the Jacobian rows by the identity. An empty list frees them all. */
+    void set_frozen_variables( const std::vector<VariableIndex>& vars );
+
+    //! Assemble the Jacobians of solve() from the named physics only
+    /*! For nonlinear solvers that apply the Jacobian matrix-free and only
+	precondition with the assembled matrix, see Solver::init_jfnk_solver.
+	The other physics still contribute to every residual. Rows of the
+	variables that no named physics owns, see Physics::owned_variables,
+	get the identity. An empty set assembles every physics. */
+    void set_preconditioner_physics( const std::set<PhysicsName>& physics_names );
+
+    //! Set how long an assembled Jacobian is reused
+    /*!
+      The Jacobian is rebuilt once newton_lag Newton iterations of the
+      current solve have used it, at the start of every step_lag-th solve,
+      or when the last linear solve took more than max_linear_iterations
+      iterations (0 disables that check). In between, Jacobian requests are
+      dropped and only the residual is assembled, and the Newton linear
+      solver is told to keep its preconditioner (same_preconditioner), so
+      e.g. an ILU factorization is reused along with the matrix. The
+      defaults (1,1,0) rebuild the Jacobian at every Newton iteration.
+      Lagging only applies to the Newton iterations of solve(); every
+      other Jacobian assembly, e.g. for adjoint_solve(), is always rebuilt.
+      max_linear_iterations > 0 needs a NewtonSolver with a PETSc linear
+      solver, whose KSP reports the iterations of each linear solve.
+     */
+    void set_jacobian_lagging( unsigned int newton_lag,
+			       unsigned int step_lag,
+			       unsigned int max_linear_iterations );
+
+    //! Force the Jacobian to be rebuilt at the next Newton iteration
+    /*! Needed whenever the Jacobian changes in ways the lagging heuristics
+	cannot see, e.g. a change of time step size. */
+    void invalidate_jacobian();
+
+    //! Residual/Jacobian assembly, skipping Jacobians that are being reused
+    virtual void assembly( bool get_residual, bool get_jacobian );
+
+    //! Nonlinear solve, tracks solve boundaries for Jacobian lagging
+    virtual void solve();
+
+    //! The system matrix is reallocated, so the Jacobian must be rebuilt
+    virtual void reinit();
+
+    //! Number of residual assemblies since construction
+    unsigned int n_residual_assemblies() const;
+
+    //! Number of Jacobian assemblies since construction
+    unsigned int n_jacobian_assemblies() const;
+
+    //! Physics enabled on the subdomain of elem, in PhysicsList order
+    const std::vector<Physics*>& physics_on_elem( const libMesh::Elem* elem ) const;
+
+    //! Whether assembly caches count quantities that are computed but never read
+    bool report_unread_cache() const;
+
+    //! Accumulate the unread counts of a context's caches
+    /*! Called by AssemblyContext on destruction when report_unread_cache()
+	is set. Safe to call from assembly threads. */
+    void record_unread_cache( const CachedValues& element_cache,
+			      const CachedValues& side_cache );
+
+    //! Print the cached quantities that were computed but never read on this processor
+    void print_unread_cache_report( std::ostream& out ) const;
+
+    //! Time the element assembly of every element
+    /*! The wall time spent in element_time_derivative, element_constraint
+	and mass_residual is summed per element until reset_element_cost().
+	Only residual assemblies are timed, so finite difference Jacobians
+	do not count. */
+    void set_measure_element_cost( bool measure );
+
+    //! Forget the measured element assembly times
+    /*! Also done by reinit(), as element ids change with the mesh. */
+    void reset_element_cost();
+
+    //! Measured assembly time of the active elements on this processor
+    libMesh::Real local_element_cost() const;
+
+    //! Cost of the active elements on this processor, by element id
+    /*! The measured assembly times if any were measured, where elements
+	not timed yet, e.g. new from refinement, get the mean. Otherwise
+	the sum of Physics::element_cost() over the physics on each
+	element. Collective, for the mean. */
+    void element_cost_weights( std::map<libMesh::dof_id_type,libMesh::Real>& weights );
+
 #ifdef GRINS_USE_GRVY_TIMERS
     //! Add GRVY Timer object to system for timing physics.
     void attach_grvy_timer( GRVY::GRVY_Timer_Class* grvy_timer );
@@ -149,7 +281,115 @@ namespace GRINS
         of by GRINS::PhysicsFactory. */
     PhysicsList _physics_list;
 
+    //! Physics enabled on each subdomain, indexed by subdomain id
+    /*! Built by build_subdomain_physics() so that assembly only visits,
+	and computes cache for, the physics enabled on each element. */
+    std::vector<std::vector<Physics*> > _subdomain_physics;
+
+    void build_subdomain_physics();
+
+    //! Physics that are not assembled, see set_active_physics()
+    std::set<PhysicsName> _inactive_physics;
+
+    //! Variables held fixed, see set_frozen_variables()
+    std::vector<VariableIndex> _frozen_variables;
+
+    //! Local dofs of the frozen variables, see set_frozen_variables()
+    std::vector<libMesh::numeric_index_type> _frozen_dofs;
+
+    //! Solution the frozen dofs are held at
+    libMesh::AutoPtr<libMesh::NumericVector<libMesh::Number> > _frozen_solution;
+
+    //! Replace the residual and Jacobian rows of the frozen dofs
+    void freeze_dofs( bool get_residual, bool get_jacobian );
+
+    //! Local dofs of vars, sorted
+    void local_dofs( const std::vector<VariableIndex>& vars,
+		     std::vector<libMesh::numeric_index_type>& dofs ) const;
+
+    //! Physics assembled into the Jacobians of solve(), see set_preconditioner_physics()
+    std::set<PhysicsName> _preconditioner_physics;
+
+    //! The physics not in _preconditioner_physics
+    std::set<const Physics*> _non_preconditioner_physics;
+
+    //! Local dofs of the variables no preconditioner physics owns
+    std::vector<libMesh::numeric_index_type> _preconditioner_identity_dofs;
+
+    //! Whether physics contributes to the Jacobian being assembled
+    bool in_jacobian( const Physics* physics ) const;
+
+    //! Cached quantities registered by the physics, their BC handlers and the QoI
+    /*! Union over all subdomains, built by build_cache_quantities() and
+	activated when an AssemblyContext is built. */
+    std::set<unsigned int> _element_cache_quantities;
+    std::set<unsigned int> _side_cache_quantities;
+
+    //! Cached quantities of the physics on each subdomain, plus the QoI's
+    /*! Indexed like _subdomain_physics. Built by build_cache_quantities(),
+	which errors if no physics on a subdomain provides a quantity
+	registered there, see Physics::provided_cache_quantities(). */
+    std::vector<std::set<unsigned int> > _subdomain_element_cache_quantities;
+    std::vector<std::set<unsigned int> > _subdomain_side_cache_quantities;
+
+    //! Cached quantities registered by the QoI, see register_qoi_cache_quantities()
+    std::set<unsigned int> _qoi_element_cache_quantities;
+    std::set<unsigned int> _qoi_side_cache_quantities;
+
+    void build_cache_quantities();
+
+    //! Make the quantities of the context's element subdomain active in its caches
+    void activate_cache_quantities( AssemblyContext& context ) const;
+
+    bool _report_unread_cache;
+    std::vector<unsigned int> _n_unread_element_cache;
+    std::vector<unsigned int> _n_unread_side_cache;
+    libMesh::Threads::spin_mutex _unread_cache_mutex;
+
     bool _use_numerical_jacobians_only;
+
+    //! Whether the Jacobian for the next Newton iteration must be assembled
+    bool rebuild_jacobian();
+
+    //! Linear solver of the NewtonSolver, NULL for other diff solvers
+    libMesh::LinearSolver<libMesh::Number>* newton_linear_solver() const;
+
+    //! Iterations of the most recent Newton linear solve
+    /*! Always 0 without a PETSc linear solver. */
+    unsigned int last_linear_solve_iterations() const;
+
+    // Jacobian lagging options, see set_jacobian_lagging()
+    unsigned int _jacobian_newton_lag;
+    unsigned int _jacobian_step_lag;
+    unsigned int _jacobian_max_linear_iterations;
+
+    // Jacobian lagging state
+    bool _have_jacobian;
+    bool _in_nonlinear_solve;
+    bool _first_newton_iteration;
+    unsigned int _newton_its_since_rebuild;
+    unsigned int _solves_since_rebuild;
+
+    //! Iterations of the linear solve of the previous Newton step
+    /*! Reset by solve() before its first step and whenever the
+	Jacobian is rebuilt. */
+    unsigned int _last_linear_iterations;
+
+    unsigned int _n_residual_assemblies;
+    unsigned int _n_jacobian_assemblies;
+
+    //! Measured assembly times of the active local elements, by element id
+    bool _measure_element_cost;
+    std::map<libMesh::dof_id_type,libMesh::Real> _element_cost;
+
+    //! Whether the current assembly is timed, see set_measure_element_cost()
+    bool _time_element_assembly;
+
+    //! Add elapsed wall time to the measured cost of elem
+    void add_element_cost( const libMesh::Elem* elem, libMesh::Real elapsed );
+
+    //! Sum of Physics::element_cost() of the active physics enabled on elem
+    libMesh::Real model_element_cost( const libMesh::Elem* elem );
     
 #ifdef GRINS_USE_GRVY_TIMERS
     GRVY::GRVY_Timer_Class* _timer;
@@ -165,6 +405,39 @@ namespace GRINS
     return _physics_list.find(physics_name)->second;
   }
 
+  inline
+  bool MultiphysicsSystem::in_jacobian( const Physics* physics ) const
+  {
+    return !_in_nonlinear_solve ||
+      _non_preconditioner_physics.find( physics ) == _non_preconditioner_physics.end();
+  }
+
+  inline
+  const std::vector<Physics*>& MultiphysicsSystem::physics_on_elem( const libMesh::Elem* elem ) const
+  {
+    libmesh_assert( elem->subdomain_id() < _subdomain_physics.size() );
+
+    return _subdomain_physics[elem->subdomain_id()];
+  }
+
+  inline
+  bool MultiphysicsSystem::report_unread_cache() const
+  {
+    return _report_unread_cache;
+  }
+
+  inline
+  unsigned int MultiphysicsSystem::n_residual_assemblies() const
+  {
+    return _n_residual_assemblies;
+  }
+
+  inline
+  unsigned int MultiphysicsSystem::n_jacobian_assemblies() const
+  {
+    return _n_jacobian_assemblies;
+  }
+
 } //End namespace block
 
 #endif // GRINS_MULTIPHYSICS_SYS_H
@@ -104,12 +104,30 @@ namespace GRINS
     //! Read options from GetPot input file. By default, nothing is read.
     virtual void read_input_options( const GetPot& input );
 
+    //! Change a scalar input parameter, named by its input path, after setup
+    /*! E.g. "Physics/IncompressibleNavierStokes/mu". Used by the
+	continuation driver in Simulation. Returns false if neither this
+	physics nor its boundary conditions use the parameter. By default,
+	only the boundary condition handler is asked. */
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
+    //! Whether the system finite differences every element Jacobian
+    /*! Called by MultiphysicsSystem::read_input_options() with
+	linear-nonlinear-solver/use_numerical_jacobians_only, which only
+	the system reads. By default, ignored. */
+    virtual void set_numerical_jacobians_only( bool numerical_jacobians_only );
+
     //! Initialize variables for this physics.
     virtual void init_variables( libMesh::FEMSystem* system ) = 0;
 
     //! Find if current physics is active on supplied element
     virtual bool enabled_on_elem( const libMesh::Elem* elem );
 
+    //! Find if current physics is active on supplied subdomain
+    /*! MultiphysicsSystem uses this to build its per-subdomain physics
+	table once, instead of querying every physics on every element. */
+    virtual bool enabled_on_subdomain( libMesh::subdomain_id_type subdomain_id ) const;
+
     //! Sets whether this physics is to be solved with a steady solver or not
     /*! Since the member variable is static, only needs to be called on a single
         physics. */
@@ -127,6 +145,15 @@ namespace GRINS
      */
     virtual void set_time_evolving_vars( libMesh::FEMSystem* system );
 
+    //! Add the variables whose equations this physics assembles to vars
+    /*!
+      Only variables whose residual rows would be empty without this
+      physics belong here, e.g. HeatTransfer adds T but not the velocity
+      it convects with. Called after init_variables(). Default
+      implementation adds nothing.
+     */
+    virtual void owned_variables( std::set<VariableIndex>& vars ) const;
+
     //! Initialize context for added physics variables
     virtual void init_context( libMesh::FEMContext& context );
 
@@ -183,6 +210,38 @@ namespace GRINS
 					const std::vector<libMesh::Point>& points,
 					CachedValues& cache );
 
+    //! Register the cached quantities this physics reads during assembly
+    /*! Quantities read on element interiors go in element_quantities and
+	those read on sides in side_quantities. MultiphysicsSystem activates
+	the union over all physics and their BC handlers, and the
+	compute_*_cache methods may skip any quantity that is not active.
+	By default, registers nothing. */
+    virtual void register_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
+    //! Add the cached quantities the compute_*_cache methods of this physics set
+    /*! MultiphysicsSystem checks that every quantity registered on a
+	subdomain, see register_cache_quantities(), is provided by some
+	physics on that subdomain. By default, provides nothing. */
+    virtual void provided_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
+    //! Whether this physics advances part of its equations outside the global solve
+    /*! If true, the UnsteadySolver calls split_time_step around each
+	global solve (Strang splitting). By default, false. */
+    virtual bool has_split_time_step() const;
+
+    //! Advance the operator split part of this physics over deltat
+    /*! Works directly on system.solution; the caller is responsible for
+	updating current_local_solution afterwards. Only called if
+	has_split_time_step() is true. By default, does nothing. */
+    virtual void split_time_step( libMesh::FEMSystem& system, libMesh::Real deltat );
+
+    //! Relative cost of assembling this physics on elem
+    /*! Used to weight the mesh partition when assembly times have not
+	been measured, see WeightedPartitioner. By default, 1. */
+    virtual libMesh::Real element_cost( const libMesh::Elem* elem ) const;
+
     BCHandlingBase* get_bc_handler(); 
 
 #ifdef GRINS_USE_GRVY_TIMERS
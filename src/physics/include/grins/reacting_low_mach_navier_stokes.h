@@ -32,6 +32,9 @@
 // GRINS
 #include "grins/reacting_low_mach_navier_stokes_base.h"
 
+// libMesh
+#include "libmesh/dense_matrix.h"
+
 namespace GRINS
 {
   template<typename Mixture, typename Evaluator>
@@ -68,33 +71,161 @@ namespace GRINS
     virtual void compute_side_time_derivative_cache( const libMesh::FEMContext& context, 
 						     CachedValues& cache );
 
+    //! Mass matrix coefficients (rho, cp, M_mix) from the fixed solution
+    virtual void compute_mass_residual_cache( const libMesh::FEMContext& context,
+					      CachedValues& cache );
+
     virtual void compute_element_cache( const libMesh::FEMContext& context,
 					const std::vector<libMesh::Point>& points,
 					CachedValues& cache );
 
+    virtual void register_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
+    virtual void provided_cache_quantities( std::set<unsigned int>& element_quantities,
+					    std::set<unsigned int>& side_quantities ) const;
+
+    //! enable_chemistry can be changed, as 0 or 1
+    virtual bool set_parameter( const std::string& param_name, libMesh::Real value );
+
+    //! Drops the property derivatives from the cache if true
+    /*! Errors if false with enable_thermo_press_calc. */
+    virtual void set_numerical_jacobians_only( bool numerical_jacobians_only );
+
+    //! True if chemistry is operator split, see split_chemistry()
+    virtual bool has_split_time_step() const;
+
+    //! chemistry_cost if omega_dot is assembled, otherwise 1
+    virtual libMesh::Real element_cost( const libMesh::Elem* elem ) const;
+
+    //! Advance the chemistry alone over deltat at every T and species node
+    /*! Each node is an independent stiff ODE system at fixed p0,
+	dY_s/dt = omega_dot_s/rho, dT/dt = -sum_s h_s omega_dot_s/(rho cp),
+	integrated with adaptive SDIRK2 substeps (see integrate_chemistry).
+	The nodes are split over threads, each with its own Evaluator. */
+    virtual void split_time_step( libMesh::FEMSystem& system, libMesh::Real deltat );
+
+    //! Advance the chemistry ODE of one node over deltat
+    /*! Substeps are halved when Newton fails or T or any Y changes by more
+	than the split_chemistry_max_delta_T/Y limits, and doubled when the
+	changes are below half the limits. z = (T, Y_0, ..., Y_{n-1}).
+	Public so a single node can be checked in isolation. */
+    void integrate_chemistry( Evaluator& gas_evaluator, CachedValues& cache,
+			      libMesh::Real deltat,
+			      std::vector<libMesh::Real>& z ) const;
+
   protected:
 
+    //! Evaluator built for this thread's context in init_context
+    /*! Reused for every element and side the context visits, so the
+        thermochemistry objects are allocated once per thread per assembly
+        rather than once per element. */
+    Evaluator& get_evaluator( const libMesh::FEMContext& context ) const;
+
+    //! Derivatives of the properties w.r.t. T and Y, needed for the element Jacobian
+    /*! omega_dot derivatives come from the evaluator (analytic for Antioch).
+        The property derivatives (mu, k, cp, h_s, D) are forward differences
+        at each qp by design: the Antioch and Cantera transport and mixing
+        models don't expose derivatives, and differencing them pointwise
+        costs n_species+1 property evaluations per qp instead of a full
+        element residual per element dof. The element assembly itself is
+        analytic given these pointwise derivatives. Must be called after
+        compute_element_time_derivative_cache. */
+    void compute_element_jacobian_cache( const libMesh::FEMContext& context,
+                                         CachedValues& cache );
+
     void assemble_mass_time_deriv(libMesh::FEMContext& c, 
 				  unsigned int qp,
+				  bool compute_jacobian,
 				  const CachedValues& cache);
 
     void assemble_species_time_deriv(libMesh::FEMContext& c, 
 				     unsigned int qp,
+				     bool compute_jacobian,
 				     const CachedValues& cache);
 
     void assemble_momentum_time_deriv(libMesh::FEMContext& c, 
 				      unsigned int qp,
+				      bool compute_jacobian,
 				      const CachedValues& cache);
 
     void assemble_energy_time_deriv(libMesh::FEMContext& c, 
 				    unsigned int qp,
+				    bool compute_jacobian,
 				    const CachedValues& cache);
 
+    void assemble_continuity_mass_residual( libMesh::FEMContext& context,
+					    unsigned int qp,
+					    bool compute_jacobian,
+					    const CachedValues& cache );
+
+    void assemble_species_mass_residual( libMesh::FEMContext& context,
+					 unsigned int qp,
+					 bool compute_jacobian,
+					 const CachedValues& cache );
+
+    void assemble_momentum_mass_residual( libMesh::FEMContext& context,
+					  unsigned int qp,
+					  bool compute_jacobian,
+					  const CachedValues& cache );
+
+    void assemble_energy_mass_residual( libMesh::FEMContext& context,
+					unsigned int qp,
+					bool compute_jacobian,
+					const CachedValues& cache );
+
+    //! Whether omega_dot is left out of the residual and integrated in split_time_step
+    /*! Steady solves have no time step to split, so there the chemistry
+	always stays in the residual. */
+    bool split_chemistry() const;
+
+    //! Whether omega_dot terms are assembled: chemistry enabled and not split
+    bool chemistry_in_residual() const;
+
+    //! Right hand side of the local chemistry ODE, with state z = (T, Y_0, ..., Y_{n-1})
+    /*! If dfdz is given, also computes an approximate Jacobian of f that
+	holds rho, cp and h_s fixed. */
+    void chemistry_rhs( Evaluator& gas_evaluator, CachedValues& cache,
+			const std::vector<libMesh::Real>& z,
+			std::vector<libMesh::Real>& f,
+			libMesh::DenseMatrix<libMesh::Real>* dfdz ) const;
+
+    //! Solves z = b + hgamma*f(z) for one SDIRK stage by simplified Newton
+    /*! z holds the initial guess. Returns false if Newton did not converge. */
+    bool solve_chemistry_stage( Evaluator& gas_evaluator, CachedValues& cache,
+				libMesh::Real hgamma,
+				const std::vector<libMesh::Real>& b,
+				std::vector<libMesh::Real>& z ) const;
+
+    //! Threaded loop over the nodes in split_time_step
+    class SplitChemistry;
+    friend class SplitChemistry;
+
     //! Enable pressure pinning
     bool _pin_pressure;
     
     PressurePinning _p_pinning;
 
+    //! Layout of species quantities (mass fractions, h_s, D, omega_dot) in the cache
+    Cache::SpeciesLayout _species_cache_layout;
+
+    //! Whether there is any chemistry at all, see set_parameter()
+    bool _enable_chemistry;
+
+    //! Operator split the chemistry (Strang splitting in the UnsteadySolver)
+    bool _split_chemistry;
+
+    //! Largest change of T and of any Y accepted in one chemistry substep
+    libMesh::Real _split_chemistry_max_delta_T;
+    libMesh::Real _split_chemistry_max_delta_Y;
+
+    //! Cost of an element with chemistry relative to one without
+    libMesh::Real _chemistry_cost;
+
+    //! The element Jacobian is finite differenced by the system, so the
+    //! property derivatives are never read. See set_numerical_jacobians_only().
+    bool _numerical_jacobians_only;
+
   private:
 
     ReactingLowMachNavierStokes();
@@ -73,7 +73,35 @@ namespace GRINS
     void D( const libMesh::Real rho, const libMesh::Real cp,
             const libMesh::Real k,
 	    std::vector<libMesh::Real>& D );
-    
+
+    //! Evaluates all assembly properties at every qp of an element in one call
+    /*! Inputs and outputs are sized to the number of qps of the element.
+        Outputs passed as NULL are not computed, so e.g. the kinetics are
+        skipped when omega_dot is not needed. p0 is unused here but kept so
+        all evaluators share this interface. */
+    void evaluate_element_batch( const std::vector<libMesh::Real>& T,
+                                 const std::vector<libMesh::Real>& p0,
+                                 const std::vector<libMesh::Real>& rho,
+                                 const std::vector<libMesh::Real>& R_mix,
+                                 const SpeciesBlock<libMesh::Real>& Y,
+                                 std::vector<libMesh::Real>* mu,
+                                 std::vector<libMesh::Real>* k,
+                                 std::vector<libMesh::Real>* cp,
+                                 SpeciesBlock<libMesh::Real>* h_s,
+                                 SpeciesBlock<libMesh::Real>* D,
+                                 SpeciesBlock<libMesh::Real>* omega_dot );
+
+    //! Thermo and transport properties at one point, without kinetics
+    /*! Used to forward difference these properties pointwise for the
+        element Jacobian; the transport and mixing models don't provide
+        derivatives. */
+    void thermo_and_transport( const libMesh::Real T, const libMesh::Real p0,
+                               const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& Y,
+                               libMesh::Real& mu, libMesh::Real& k, libMesh::Real& cp,
+                               std::vector<libMesh::Real>& h_s,
+                               std::vector<libMesh::Real>& D );
+
   protected:
 
     const libMesh::Real _mu;
@@ -82,6 +110,9 @@ namespace GRINS
 
     const Antioch::ConstantLewisDiffusivity<libMesh::Real>& _diffusivity;
 
+    //! Per-qp scratch for evaluate_element_batch, also holds unrequested intermediates
+    std::vector<libMesh::Real> _D_qp, _k_qp, _cp_qp;
+
   private:
 
     AntiochConstantTransportEvaluator();
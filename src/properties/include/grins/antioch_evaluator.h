@@ -44,6 +44,9 @@
 #include "antioch/cea_evaluator.h"
 #include "antioch/stat_mech_thermo.h"
 
+// C++
+#include <valarray>
+
 // Boost
 #include <boost/scoped_ptr.hpp>
 
@@ -92,8 +95,54 @@ namespace GRINS
     void omega_dot( const CachedValues& cache, unsigned int qp,
 		    std::vector<libMesh::Real>& omega_dot );
 
+    //! Batched thermo and kinetics over all quadrature points of an element
+    /*! For CEA thermo, cp, h_s and the Gibbs terms feeding omega_dot are
+        evaluated by Antioch on a qp-length std::valarray state, one call
+        per species for the whole element. StatMech thermo and the
+        reaction rates themselves are still evaluated one qp at a time.
+        All inputs and outputs are sized to the number of qps.
+        h_s and omega_dot are skipped if NULL. */
+    void thermo_and_kinetics( const std::vector<libMesh::Real>& T,
+                              const std::vector<libMesh::Real>& rho,
+                              const std::vector<libMesh::Real>& R_mix,
+                              const SpeciesBlock<libMesh::Real>& Y,
+                              std::vector<libMesh::Real>& cp,
+                              SpeciesBlock<libMesh::Real>* h_s,
+                              SpeciesBlock<libMesh::Real>* omega_dot );
+
+    //! Derivatives of omega_dot w.r.t. T and Y at fixed thermodynamic pressure
+    /*! Uses Antioch's analytic kinetics derivatives. domega_dot_dY[i][k] is
+        d(omega_dot_i)/d(Y_k), with rho = p0/(R_mix*T) varying with T and Y. */
+    void omega_dot_derivs( const libMesh::Real T, const libMesh::Real rho,
+                           const libMesh::Real R_mix,
+                           const std::vector<libMesh::Real>& Y,
+                           std::vector<libMesh::Real>& domega_dot_dT,
+                           std::vector<std::vector<libMesh::Real> >& domega_dot_dY );
+
   protected:
 
+    libMesh::Real cp( const Antioch::TempCache<libMesh::Real>& temp_cache,
+                      const std::vector<libMesh::Real>& Y );
+
+    void h_s( const Antioch::TempCache<libMesh::Real>& temp_cache,
+              std::vector<libMesh::Real>& h_s );
+
+    //! Copy T and Y into _T_batch and _Y_batch
+    void gather_batch_state( const std::vector<libMesh::Real>& T,
+                             const SpeciesBlock<libMesh::Real>& Y );
+
+    //! thermo_and_kinetics() on the state from gather_batch_state()
+    void batch_thermo_and_kinetics( const std::vector<libMesh::Real>& rho,
+                                    const std::vector<libMesh::Real>& R_mix,
+                                    const SpeciesBlock<libMesh::Real>& Y,
+                                    std::vector<libMesh::Real>& cp,
+                                    SpeciesBlock<libMesh::Real>* h_s,
+                                    SpeciesBlock<libMesh::Real>* omega_dot );
+
+    //! Specialized on Thermo; h_s is skipped if NULL
+    void batch_cp_and_h_s( std::vector<libMesh::Real>& cp,
+                           SpeciesBlock<libMesh::Real>* h_s );
+
     const AntiochMixture& _chem;
     
     // This is a template type
@@ -103,6 +152,29 @@ namespace GRINS
 
     boost::scoped_ptr<Antioch::TempCache<libMesh::Real> > _temp_cache;
 
+    //! Mass fractions at the current qp, gathered from the cache SpeciesBlock
+    std::vector<libMesh::Real> _Y;
+
+    //! Per-qp species scratch for the batched evaluations
+    std::vector<libMesh::Real> _omega_dot_qp;
+
+    //! Scratch for the kinetics derivatives at fixed partial densities
+    std::vector<libMesh::Real> _domega_dot_dT_qp;
+
+    std::vector<std::vector<libMesh::Real> > _domega_dot_drho_s_qp;
+
+    //! Element state for the batched evaluations, one entry per qp
+    std::valarray<libMesh::Real> _T_batch;
+
+    //! Per-species element state, _Y_batch[s][qp]
+    std::vector<std::valarray<libMesh::Real> > _Y_batch;
+
+    std::vector<std::valarray<libMesh::Real> > _h_RT_minus_s_R_batch;
+
+    std::vector<libMesh::Real> _h_RT_minus_s_R_qp;
+
+    std::valarray<libMesh::Real> _cp_batch, _species_batch;
+
     //! Helper method for managing _temp_cache
     /*! T *MUST* be pass-by-reference because of the structure
         of Antioch::TempCache! */
@@ -35,13 +35,16 @@
 
 // C++
 #include <vector>
+#include <valarray>
 
 // libMesh
 #include "libmesh/libmesh_common.h"
 
 // Antioch
 #include "antioch/vector_utils_decl.h"
+#include "antioch/valarray_utils_decl.h"
 #include "antioch/vector_utils.h"
+#include "antioch/valarray_utils.h"
 #include "antioch/kinetics_evaluator.h"
 #include "antioch/cea_evaluator.h"
 namespace GRINS
@@ -62,6 +65,31 @@ namespace GRINS
                     const std::vector<libMesh::Real>& mass_fractions,
                     std::vector<libMesh::Real>& omega_dot );
 
+    //! Mass sources from a caller-supplied h_RT_minus_s_R
+    /*! Lets element-batched callers evaluate the CEA Gibbs terms for
+        all quadrature points at once with h_RT_minus_s_R() below. */
+    void omega_dot( const libMesh::Real T,
+                    const libMesh::Real rho,
+                    const libMesh::Real R_mix,
+                    const std::vector<libMesh::Real>& mass_fractions,
+                    const std::vector<libMesh::Real>& h_RT_minus_s_R,
+                    std::vector<libMesh::Real>& omega_dot );
+
+    //! h/(RT) - s/R of each species at every temperature in temp_cache
+    void h_RT_minus_s_R( const Antioch::TempCache<std::valarray<libMesh::Real> >& temp_cache,
+                         std::vector<std::valarray<libMesh::Real> >& h_RT_minus_s_R ) const;
+
+    //! Mass sources and their analytic derivatives
+    /*! domega_dot_dT is taken at fixed partial densities and
+        domega_dot_drho_s[i][s] is d(omega_dot_i)/d(rho_s). */
+    void omega_dot_and_derivs( const Antioch::TempCache<libMesh::Real>& temp_cache,
+                               const libMesh::Real rho,
+                               const libMesh::Real R_mix,
+                               const std::vector<libMesh::Real>& mass_fractions,
+                               std::vector<libMesh::Real>& omega_dot,
+                               std::vector<libMesh::Real>& domega_dot_dT,
+                               std::vector<std::vector<libMesh::Real> >& domega_dot_drho_s );
+
   protected:
 
     const AntiochMixture& _antioch_mixture;
@@ -70,6 +98,11 @@ namespace GRINS
 
     Antioch::CEAEvaluator<libMesh::Real> _antioch_cea_thermo;
 
+    //! Scratch for omega_dot()
+    std::vector<libMesh::Real> _h_RT_minus_s_R;
+
+    std::vector<libMesh::Real> _molar_densities;
+
   private:
 
     AntiochKinetics();
@@ -42,7 +42,9 @@
 
 // Antioch
 #include "antioch/vector_utils_decl.h"
+#include "antioch/valarray_utils_decl.h"
 #include "antioch/vector_utils.h"
+#include "antioch/valarray_utils.h"
 #include "antioch/chemical_mixture.h"
 #include "antioch/cea_mixture.h"
 #include "antioch/reaction_set.h"
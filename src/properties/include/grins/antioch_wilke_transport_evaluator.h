@@ -33,6 +33,9 @@
 
 #ifdef GRINS_HAVE_ANTIOCH
 
+// C++
+#include <valarray>
+
 // GRINS
 #include "grins/antioch_evaluator.h"
 #include "grins/antioch_wilke_transport_mixture.h"
@@ -73,13 +76,47 @@ namespace GRINS
     void D( const libMesh::Real rho, const libMesh::Real cp,
             const libMesh::Real k,
 	    std::vector<libMesh::Real>& D );
-    
+
+    //! Evaluates all assembly properties at every qp of an element in one call
+    /*! Inputs and outputs are sized to the number of qps of the element.
+        Outputs passed as NULL are not computed, so e.g. the kinetics are
+        skipped when omega_dot is not needed. p0 is unused here but kept so
+        all evaluators share this interface. */
+    void evaluate_element_batch( const std::vector<libMesh::Real>& T,
+                                 const std::vector<libMesh::Real>& p0,
+                                 const std::vector<libMesh::Real>& rho,
+                                 const std::vector<libMesh::Real>& R_mix,
+                                 const SpeciesBlock<libMesh::Real>& Y,
+                                 std::vector<libMesh::Real>* mu,
+                                 std::vector<libMesh::Real>* k,
+                                 std::vector<libMesh::Real>* cp,
+                                 SpeciesBlock<libMesh::Real>* h_s,
+                                 SpeciesBlock<libMesh::Real>* D,
+                                 SpeciesBlock<libMesh::Real>* omega_dot );
+
+    //! Thermo and transport properties at one point, without kinetics
+    /*! Used to forward difference these properties pointwise for the
+        element Jacobian; the transport and mixing models don't provide
+        derivatives. */
+    void thermo_and_transport( const libMesh::Real T, const libMesh::Real p0,
+                               const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& Y,
+                               libMesh::Real& mu, libMesh::Real& k, libMesh::Real& cp,
+                               std::vector<libMesh::Real>& h_s,
+                               std::vector<libMesh::Real>& D );
+
   protected:
 
     boost::scoped_ptr<Antioch::WilkeEvaluator<Viscosity,Conductivity> > _wilke_evaluator;
 
     const Diffusivity& _diffusivity;
 
+    //! Per-qp scratch for evaluate_element_batch, also holds unrequested intermediates
+    std::vector<libMesh::Real> _D_qp, _mu_qp, _k_qp, _cp_qp;
+
+    //! mu and k on the element's qp-length state
+    std::valarray<libMesh::Real> _mu_batch, _k_batch;
+
   private:
 
     AntiochWilkeTransportEvaluator();
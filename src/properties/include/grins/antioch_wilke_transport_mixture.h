@@ -43,7 +43,9 @@
 
 // Antioch
 #include "antioch/vector_utils_decl.h"
+#include "antioch/valarray_utils_decl.h"
 #include "antioch/vector_utils.h"
+#include "antioch/valarray_utils.h"
 #include "antioch/cea_evaluator.h"
 #include "antioch/stat_mech_thermo.h"
 #include "antioch/wilke_mixture.h"
@@ -38,6 +38,7 @@
 #include "grins/cantera_thermo.h"
 #include "grins/cantera_transport.h"
 #include "grins/cantera_kinetics.h"
+#include "grins/species_block.h"
 
 namespace GRINS
 {
@@ -90,19 +91,76 @@ namespace GRINS
     void omega_dot( const CachedValues& cache, unsigned int qp,
 		    std::vector<libMesh::Real>& omega_dot ) const;
 
+    //! Evaluates all assembly properties at every qp of an element in one call
+    /*! The gas state is set once per qp, rather than once per property per qp.
+        Outputs passed as NULL are not computed. */
+    void evaluate_element_batch( const std::vector<libMesh::Real>& T,
+                                 const std::vector<libMesh::Real>& p0,
+                                 const std::vector<libMesh::Real>& rho,
+                                 const std::vector<libMesh::Real>& R_mix,
+                                 const SpeciesBlock<libMesh::Real>& Y,
+                                 std::vector<libMesh::Real>* mu,
+                                 std::vector<libMesh::Real>* k,
+                                 std::vector<libMesh::Real>* cp,
+                                 SpeciesBlock<libMesh::Real>* h_s,
+                                 SpeciesBlock<libMesh::Real>* D,
+                                 SpeciesBlock<libMesh::Real>* omega_dot );
+
+    //! Thermo and transport properties at one point, without kinetics
+    /*! Used to forward difference these properties pointwise for the
+        element Jacobian; the transport and mixing models don't provide
+        derivatives. */
+    void thermo_and_transport( const libMesh::Real T, const libMesh::Real p0,
+                               const libMesh::Real rho,
+                               const std::vector<libMesh::Real>& Y,
+                               libMesh::Real& mu, libMesh::Real& k, libMesh::Real& cp,
+                               std::vector<libMesh::Real>& h_s,
+                               std::vector<libMesh::Real>& D );
+
+    //! Derivatives of omega_dot w.r.t. T and Y at fixed thermodynamic pressure
+    /*! Cantera has no analytic kinetics derivatives, so these are one-sided
+        finite differences of Cantera's net production rates on our own phase,
+        with steps of sqrt(machine epsilon) relative to T and max(|Y_k|,1).
+        Y is perturbed without renormalization, so domega_dot_dY[i][k] is
+        d(omega_dot_i)/d(Y_k) with every other Y_s held fixed. */
+    void omega_dot_derivs( const libMesh::Real T, const libMesh::Real rho,
+                           const libMesh::Real R_mix,
+                           const std::vector<libMesh::Real>& Y,
+                           std::vector<libMesh::Real>& domega_dot_dT,
+                           std::vector<std::vector<libMesh::Real> >& domega_dot_dY );
+
   protected:
 
     CanteraMixture& _chem;
 
+    //! Phase checked out from the mixture pool, shared by _thermo, _transport and _kinetics
+    unsigned int _phase_slot;
+
+    Cantera::IdealGasMix& _gas;
+
+    Cantera::Transport& _gas_transport;
+
     CanteraThermodynamics _thermo;
 
     CanteraTransport _transport;
 
     CanteraKinetics _kinetics;
 
+    //! Per-qp scratch for evaluate_element_batch
+    std::vector<libMesh::Real> _Y, _h_RT, _D_qp, _omega_dot_qp;
+
+    //! Scratch for omega_dot_derivs
+    std::vector<libMesh::Real> _omega_dot_pert;
+
+    //! Sets the state on our phase, without normalizing Y, and returns the mass production rates in [kg/m^3-s]
+    void mass_production_rates( const libMesh::Real T, const libMesh::Real P,
+                                const std::vector<libMesh::Real>& Y,
+                                std::vector<libMesh::Real>& omega_dot );
+
   private:
 
     CanteraEvaluator();
+    CanteraEvaluator( const CanteraEvaluator& );
 
   };
 
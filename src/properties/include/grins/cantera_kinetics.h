@@ -58,7 +58,12 @@ namespace GRINS
   {
   public:
 
+    //! Checks out its own phase from the mixture pool
     CanteraKinetics( CanteraMixture& mixture );
+
+    //! Uses a phase the caller already checked out, e.g. CanteraEvaluator
+    CanteraKinetics( CanteraMixture& mixture, unsigned int phase_slot );
+
     ~CanteraKinetics();
 
     void omega_dot( const CachedValues& cache, unsigned int qp,
@@ -70,11 +75,18 @@ namespace GRINS
 
   protected:
 
+    CanteraMixture& _cantera_mixture;
+
+    //! Pool slot of our phase and whether we hand it back on destruction
+    unsigned int _phase_slot;
+    bool _owns_phase;
+
     Cantera::IdealGasMix& _cantera_gas;
 
   private:
 
     CanteraKinetics();
+    CanteraKinetics( const CanteraKinetics& );
 
   };
 
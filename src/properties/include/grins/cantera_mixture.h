@@ -43,14 +43,13 @@
 // Boost
 #include <boost/scoped_ptr.hpp>
 
+// C++
+#include <string>
+#include <vector>
+
 // libMesh forward declarations
 class GetPot;
 
-namespace
-{
-  static libMesh::Threads::spin_mutex cantera_mutex;
-}
-
 namespace GRINS
 {
   class CanteraMixture
@@ -60,11 +59,34 @@ namespace GRINS
     CanteraMixture( const GetPot& input );
     ~CanteraMixture();
 
+    //! Master phase, used for species data
+    /*! Setting the state on the master phase is not thread safe; evaluators
+        should check out their own phase from the pool instead. */
     Cantera::IdealGasMix& get_chemistry();
     const Cantera::IdealGasMix& get_chemistry() const;
 
     Cantera::Transport& get_transport();
 
+    //! Check out an IdealGasMix/Transport clone for exclusive use
+    /*! The caller owns the returned slot until it is handed back with
+        checkin_phase(), so it may set the gas state without locking.
+        Clones are built on demand, so the pool grows to the peak number
+        of concurrently live evaluators, i.e. the number of threads. */
+    unsigned int checkout_phase();
+
+    //! Hand a slot obtained from checkout_phase() back to the pool
+    void checkin_phase( unsigned int slot );
+
+    //! Phase for a checked out slot
+    /*! Another thread may be growing the pool, so this takes the pool lock.
+        Look the phase up once and hold on to the reference. */
+    Cantera::IdealGasMix& get_chemistry( unsigned int slot );
+
+    Cantera::Transport& get_transport( unsigned int slot );
+
+    //! Number of clones built so far
+    unsigned int n_pool_phases();
+
     libMesh::Real M( unsigned int species ) const;
 
     libMesh::Real M_mix( const std::vector<libMesh::Real>& mass_fractions ) const;
@@ -95,6 +117,20 @@ namespace GRINS
 
     boost::scoped_ptr<Cantera::Transport> _cantera_transport;
 
+    //! Needed to build clones of the master phase
+    std::string _chem_file;
+    std::string _mixture_name;
+
+    //! Pool of clones owned by this object, indexed by slot
+    std::vector<Cantera::IdealGasMix*> _gas_pool;
+    std::vector<Cantera::Transport*> _transport_pool;
+
+    //! Slots that are built but not currently checked out
+    std::vector<unsigned int> _free_slots;
+
+    //! Guards checkout and checkin only, never property evaluation
+    libMesh::Threads::spin_mutex _pool_mutex;
+
   private:
 
     CanteraMixture();
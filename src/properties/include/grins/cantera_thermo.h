@@ -58,7 +58,12 @@ namespace GRINS
   {
   public:
 
+    //! Checks out its own phase from the mixture pool
     CanteraThermodynamics( CanteraMixture& mixture );
+
+    //! Uses a phase the caller already checked out, e.g. CanteraEvaluator
+    CanteraThermodynamics( CanteraMixture& mixture, unsigned int phase_slot );
+
     ~CanteraThermodynamics();
 
     libMesh::Real cp( const CachedValues& cache, unsigned int qp ) const;
@@ -73,11 +78,16 @@ namespace GRINS
 
     CanteraMixture& _cantera_mixture;
 
+    //! Pool slot of our phase and whether we hand it back on destruction
+    unsigned int _phase_slot;
+    bool _owns_phase;
+
     Cantera::IdealGasMix& _cantera_gas;
 
   private:
 
     CanteraThermodynamics();
+    CanteraThermodynamics( const CanteraThermodynamics& );
 
   };
 
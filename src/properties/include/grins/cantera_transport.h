@@ -60,7 +60,12 @@ namespace GRINS
   {
   public:
     
+    //! Checks out its own phase from the mixture pool
     CanteraTransport( CanteraMixture& mixture );
+
+    //! Uses a phase the caller already checked out, e.g. CanteraEvaluator
+    CanteraTransport( CanteraMixture& mixture, unsigned int phase_slot );
+
     ~CanteraTransport();
 
     libMesh::Real mu( const CachedValues& cache, unsigned int qp ) const;
@@ -72,6 +77,12 @@ namespace GRINS
 
   protected:
 
+    CanteraMixture& _cantera_mixture;
+
+    //! Pool slot of our phase and whether we hand it back on destruction
+    unsigned int _phase_slot;
+    bool _owns_phase;
+
     Cantera::IdealGasMix& _cantera_gas;
 
     Cantera::Transport& _cantera_transport;
@@ -79,6 +90,7 @@ namespace GRINS
   private:
 
     CanteraTransport();
+    CanteraTransport( const CanteraTransport& );
 
   };
 
@@ -31,6 +31,7 @@
 
 // C++
 #include <iomanip>
+#include <set>
 
 // libMesh
 #include "libmesh/diff_qoi.h"
@@ -64,6 +65,16 @@ namespace GRINS
      */
     virtual void init( const GetPot& /*input*/, const MultiphysicsSystem& /*system*/ ){};
 
+    /*!
+     * Register the cached quantities this QoI reads, as Physics::register_cache_quantities.
+     * MultiphysicsSystem activates them in the caches of the contexts it builds, which
+     * are also the contexts passed to element_qoi() and side_qoi(). The cache is not
+     * filled before those calls, so a QoI reading it computes it first, e.g. with
+     * MultiphysicsSystem::compute_element_cache(). By default, registers nothing.
+     */
+    virtual void register_cache_quantities( std::set<unsigned int>& element_quantities,
+                                            std::set<unsigned int>& side_quantities ) const;
+
     /*!
      * Method to allow QoI to resize libMesh::System storage of QoI computations.
      * \todo Right now, we're only dealing with 1 QoI at a time. Need to generalize.
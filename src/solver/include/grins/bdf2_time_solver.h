@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_BDF2_TIME_SOLVER_H
+#define GRINS_BDF2_TIME_SOLVER_H
+
+// GRINS
+#include "grins/euler_stage_time_solver.h"
+
+namespace GRINS
+{
+  //! Variable step, second order backward differentiation formula
+  /*!
+    With \f$ \omega = \Delta t_n/\Delta t_{n-1} \f$, each step is a
+    backward Euler solve from
+    \f$ w = ((1+\omega)^2 u^n - \omega^2 u^{n-1})/(1+2\omega) \f$
+    with time step \f$ \Delta t_n (1+\omega)/(1+2\omega) \f$. The first
+    step is backward Euler. \f$ u^{n-1} \f$ is kept in the system vector
+    "_older_nonlinear_solution", so it is projected under mesh refinement
+    and saved with the other system vectors. Whether that vector holds a
+    history, and the length of the step that produced it, are tracked
+    explicitly: a Checkpoint stores them in its header and restores them
+    with set_history(), so a checkpoint restart continues with BDF2. A
+    restart from an xda/xdr file has no such record and starts again
+    with a backward Euler step.
+   */
+  class BDF2TimeSolver : public EulerStageTimeSolver
+  {
+  public:
+
+    BDF2TimeSolver( sys_type& system );
+    virtual ~BDF2TimeSolver();
+
+    //! Adds the vector for the solution history
+    virtual void init();
+
+    virtual void solve();
+
+    //! Shifts the solution history and advances the time
+    virtual void advance_timestep();
+
+    virtual libMesh::Real error_order() const;
+
+    //! Whether the next step is BDF2, i.e. _older_nonlinear_solution is set
+    bool has_history() const;
+
+    //! Length of the step that ended at the old solution, 0 without history
+    libMesh::Real previous_deltat() const;
+
+    //! Restore the history state of a saved _older_nonlinear_solution
+    /*! A previous_deltat of 0 means there is no history, and the next
+	step is backward Euler. */
+    void set_history( libMesh::Real previous_deltat );
+
+  protected:
+
+    //! Whether _older_nonlinear_solution holds the solution of the previous step
+    bool _have_history;
+
+    //! Length of the previous step
+    libMesh::Real _last_deltat;
+
+  };
+
+  inline
+  bool BDF2TimeSolver::has_history() const
+  {
+    return _have_history;
+  }
+
+  inline
+  libMesh::Real BDF2TimeSolver::previous_deltat() const
+  {
+    return _have_history ? _last_deltat : 0.0;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_BDF2_TIME_SOLVER_H
@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_CHECKPOINT_H
+#define GRINS_CHECKPOINT_H
+
+// C++
+#include <deque>
+#include <string>
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  class EquationSystems;
+  class DofObject;
+  template <typename T> class NumericVector;
+}
+
+namespace GRINS
+{
+  // Forward declarations
+  class MultiphysicsSystem;
+
+  //! Writes rolling restart checkpoints during a time dependent run
+  /*! A checkpoint is written every checkpoint-options/interval time
+      steps and/or every wall_time_interval seconds. Each one is a
+      directory directory/prefix.NNNNNN holding a header written by
+      processor 0, one data file per processor and, with write_mesh
+      (the default if the mesh is adapted), the mesh in a CheckpointIO
+      file that keeps the element and node ids.
+
+      Each processor copies its local degrees of freedom of every system
+      vector into a buffer and a background thread writes the buffer
+      while the solve goes on. The checkpoint is written into a .tmp
+      directory and renamed once every processor has finished, which is
+      checked before the next checkpoint or at the end of the run, so a
+      checkpoint directory without .tmp is always complete. Only the
+      newest n_keep checkpoints are kept.
+
+      Values are stored by node or element id, variable and component
+      rather than by dof index, so a run can restart from a checkpoint
+      on any number of processors, see read(). */
+  class Checkpoint
+  {
+  public:
+
+    Checkpoint( const GetPot& input );
+    ~Checkpoint();
+
+    //! Whether checkpoint-options asks for checkpoints
+    static bool enabled( const GetPot& input );
+
+    //! Count a completed time step and write a checkpoint if one is due
+    void step_completed( libMesh::EquationSystems& equation_system,
+			 MultiphysicsSystem& system );
+
+    //! Start writing a checkpoint of the current solution
+    /*! Waits for the previous checkpoint first. Returns once the data
+	is copied; the data files are written in the background. */
+    void write( libMesh::EquationSystems& equation_system,
+		MultiphysicsSystem& system );
+
+    //! Wait for the checkpoint being written and publish it
+    void finish( const libMesh::Parallel::Communicator& comm );
+
+    //! Continue the step numbering of a restarted run
+    void set_first_step( unsigned int step );
+
+    //! Restore the time and every system vector stored in a checkpoint directory
+    /*! Every processor reads all the data files and keeps the values of
+	the dofs it owns. The mesh must have the ids of the checkpointed
+	mesh: the same mesh input, or mesh-options/mesh_filename set to the
+	mesh.cpr file of the checkpoint. Returns the time step number of
+	the checkpoint. */
+    static unsigned int read( const std::string& directory,
+			      libMesh::EquationSystems& equation_system,
+			      MultiphysicsSystem& system );
+
+  protected:
+
+    //! One data file being written by the background thread
+    struct PendingWrite
+    {
+      std::string filename;
+      std::vector<char> buffer;
+      bool ok;
+    };
+
+    std::string checkpoint_name( unsigned int step ) const;
+
+    //! Append the local dofs of one node or element to the buffer
+    void pack_dofs( const libMesh::DofObject& dof_object,
+		    unsigned int kind,
+		    const MultiphysicsSystem& system,
+		    const std::vector<const libMesh::NumericVector<libMesh::Number>*>& vectors,
+		    std::vector<char>& buffer ) const;
+
+    //! Delete a checkpoint directory and the files in it
+    void remove_checkpoint( const std::string& name ) const;
+
+    //! Write a checkpoint every _interval time steps, 0 never
+    unsigned int _interval;
+
+    //! Write a checkpoint every _wall_time_interval seconds, 0 never
+    double _wall_time_interval;
+
+    std::string _directory;
+    std::string _prefix;
+
+    //! Number of complete checkpoints kept on disk
+    unsigned int _n_keep;
+
+    bool _write_mesh;
+
+    //! Time steps taken, including those before a restart
+    unsigned int _step;
+
+    double _last_write_time;
+
+    //! Whether a checkpoint is being written
+    bool _pending;
+    bool _threaded;
+    PendingWrite _pending_write;
+
+    //! The background thread, defined in checkpoint.C so this header
+    //! does not need pthread.h
+    struct WriterThread;
+    WriterThread* _writer;
+    std::string _pending_name;
+
+    //! Published checkpoints of this run, oldest first
+    std::deque<std::string> _completed;
+
+  };
+
+} // end namespace GRINS
+#endif // GRINS_CHECKPOINT_H
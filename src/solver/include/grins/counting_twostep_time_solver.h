@@ -0,0 +1,77 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_COUNTING_TWOSTEP_TIME_SOLVER_H
+#define GRINS_COUNTING_TWOSTEP_TIME_SOLVER_H
+
+// libMesh
+#include "libmesh/twostep_time_solver.h"
+
+namespace GRINS
+{
+  //! libMesh::TwostepTimeSolver that counts the steps it rejects
+  /*!
+    solve() runs the TwostepTimeSolver algorithm itself so that every
+    attempt at a step is visible: each step is taken once with deltat
+    and once as two steps of deltat/2, their difference estimates the
+    error, and a step whose error exceeds upper_tolerance is retried
+    with half the time step. If the core time solver retries a failed
+    Newton solve (reduce_deltat_on_diffsolver_failure), it halves
+    deltat, which solve() detects by comparing deltat before and after
+    the core solve. Both kinds of retry count as rejected steps.
+   */
+  class CountingTwostepTimeSolver : public libMesh::TwostepTimeSolver
+  {
+  public:
+
+    CountingTwostepTimeSolver( sys_type& system );
+    virtual ~CountingTwostepTimeSolver();
+
+    virtual void solve();
+
+    //! Steps rejected since construction
+    unsigned int n_rejected_steps() const;
+
+  protected:
+
+    //! core_time_solver->solve(), counting its Newton failure retries
+    void counted_core_solve();
+
+    unsigned int _n_rejected_steps;
+
+  };
+
+  inline
+  unsigned int CountingTwostepTimeSolver::n_rejected_steps() const
+  {
+    return _n_rejected_steps;
+  }
+
+} // end namespace GRINS
+
+#endif // GRINS_COUNTING_TWOSTEP_TIME_SOLVER_H
@@ -0,0 +1,74 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_EULER_STAGE_TIME_SOLVER_H
+#define GRINS_EULER_STAGE_TIME_SOLVER_H
+
+// libMesh
+#include "libmesh/euler_solver.h"
+#include "libmesh/numeric_vector.h"
+
+namespace GRINS
+{
+  //! Base class for time integrators whose stages are backward Euler solves
+  /*!
+    Each BDF2 step and each SDIRK stage solves
+    \f[ M(u)(u - w) + \Delta t_s F(u) = 0 \f]
+    for some combination w of earlier solutions and an effective time step
+    \f$ \Delta t_s \f$. solve_stage() temporarily installs w as the old
+    solution and \f$ \Delta t_s \f$ as the time step and then calls
+    libMesh::EulerSolver::solve() with theta = 1, so the physics residuals
+    and MultiphysicsSystem::mass_residual are used as they are.
+   */
+  class EulerStageTimeSolver : public libMesh::EulerSolver
+  {
+  public:
+
+    EulerStageTimeSolver( sys_type& system );
+    virtual ~EulerStageTimeSolver();
+
+  protected:
+
+    //! Backward Euler solve from stage_old_solution with time step stage_deltat
+    /*! The old solution and deltat are restored afterwards, so callers
+	and advance_timestep() only ever see a step of deltat. */
+    void solve_stage( const libMesh::NumericVector<libMesh::Number>& stage_old_solution,
+		      libMesh::Real stage_deltat );
+
+    //! Takes the first-solve step UnsteadySolver::solve() would otherwise take
+    /*! Must be called before reading the old solution in solve(). */
+    void begin_solve();
+
+    //! Effective time step of the last stage, to detect stale Jacobians
+    libMesh::Real _last_stage_deltat;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_EULER_STAGE_TIME_SOLVER_H
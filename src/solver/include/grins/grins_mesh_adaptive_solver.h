@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_MESH_ADAPTIVE_SOLVER_H
+#define GRINS_MESH_ADAPTIVE_SOLVER_H
+
+//GRINS
+#include "grins/grins_solver.h"
+#include "grins/mesh_adaptivity_options.h"
+
+// libMesh
+#include "libmesh/error_estimator.h"
+
+namespace GRINS
+{
+  //! Steady solver that adapts the mesh to the QoI or solution error
+  /*! Each step solves on the current mesh, estimates the error of each
+      element, then refines and coarsens the mesh. With a QoI, the
+      default estimate is the adjoint weighted residual, so that elements
+      are refined where they contribute most to the QoI error. The loop
+      stops after max_refinement_steps, once the global error estimate is
+      below absolute_global_tolerance, or once the system has max_dofs
+      degrees of freedom. */
+  class MeshAdaptiveSolver : public Solver
+  {
+  public:
+
+    MeshAdaptiveSolver( const GetPot& input );
+    virtual ~MeshAdaptiveSolver();
+
+    virtual void solve( SolverContext& context );
+
+  protected:
+
+    virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
+
+    std::tr1::shared_ptr<libMesh::ErrorEstimator> _error_estimator;
+
+    //! Sum the element errors instead of taking their l2 norm
+    /*! The adjoint weighted residual estimates are signed contributions
+	to the QoI error, which add up to the global estimate. */
+    bool _sum_element_errors;
+
+    MeshAdaptivityOptions _adaptivity_options;
+
+    // Adaptive loop options
+    unsigned int _max_refinement_steps;
+    libMesh::Real _absolute_global_tolerance;
+    unsigned int _max_dofs;
+
+    // Output options
+    bool _plot_cell_errors;
+    std::string _error_plot_prefix;
+
+  };
+} // namespace GRINS
+#endif // GRINS_MESH_ADAPTIVE_SOLVER_H
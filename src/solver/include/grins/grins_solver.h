@@ -30,6 +30,8 @@
 #define GRINS_SOLVER_H
 
 // C++
+#include <set>
+#include <string>
 #include "boost/tr1/memory.hpp"
 
 // GRINS
@@ -79,6 +81,22 @@ namespace GRINS
     unsigned int _max_linear_iterations;
     double _initial_linear_tolerance;
 
+    //! Nonlinear solver type, "newton" (default) or "jfnk"
+    /*! With "jfnk", the Krylov solver applies the Jacobian through
+	finite differenced residual evaluations and the assembled
+	Jacobian is only used to build the preconditioner, reassembled
+	every _jacobian_lag_newton_iterations Newton steps. */
+    std::string _nonlinear_solver_type;
+
+    //! Physics assembled into the JFNK preconditioner, all if empty
+    /*! See MultiphysicsSystem::set_preconditioner_physics(). */
+    std::set<std::string> _jfnk_preconditioner_physics;
+
+    // Jacobian reuse options, see MultiphysicsSystem::set_jacobian_lagging()
+    unsigned int _jacobian_lag_newton_iterations;
+    unsigned int _jacobian_lag_time_steps;
+    unsigned int _jacobian_rebuild_linear_iterations;
+
     // Screen display options
     bool _solver_quiet;
     bool _solver_verbose;    
@@ -90,6 +108,12 @@ namespace GRINS
 
     void set_solver_options( libMesh::DiffSolver& solver );
 
+    //! Replace the default Newton solver with a matrix-free one
+    void init_jfnk_solver( GRINS::MultiphysicsSystem* system );
+
+    //! Report how many residuals and Jacobians were assembled
+    void print_assembly_counts( const GRINS::MultiphysicsSystem& system ) const;
+
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system)=0;
 
   };
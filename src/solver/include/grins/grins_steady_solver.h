@@ -47,6 +47,30 @@ namespace GRINS
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
 
+    //! Pseudo-transient continuation followed by a pure Newton solve
+    /*! The pseudo time step follows switched evolution relaxation,
+	\f$ \Delta \tau_{n+1} = \Delta \tau_n (\|F_n\|/\|F_{n+1}\|)^{p} \f$,
+	where F is the steady residual. Once \f$ \|F\| \f$ has dropped by
+	newton_switch_tolerance, the mass terms are dropped and Newton
+	finishes the solve. */
+    void pseudo_transient_solve( GRINS::MultiphysicsSystem& system );
+
+    //! l2 norm of the steady residual at the current solution
+    libMesh::Real steady_residual_norm( GRINS::MultiphysicsSystem& system );
+
+    // Pseudo-transient continuation options
+    bool _pseudo_transient;
+    libMesh::Real _initial_pseudo_deltat;
+    libMesh::Real _max_pseudo_deltat;
+    libMesh::Real _ser_exponent;
+    unsigned int _max_pseudo_steps;
+    libMesh::Real _newton_switch_tolerance;
+
+    //! Newton iterations taken in each pseudo time step
+    /*! Pseudo time steps need not be converged, the default of one
+	iteration gives the usual pseudo-transient continuation. */
+    unsigned int _pseudo_newton_iterations;
+
   };
 } // namespace GRINS
 #endif // GRINS_STEADY_SOLVER_H
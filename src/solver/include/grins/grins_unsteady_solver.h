@@ -31,6 +31,10 @@
 
 //GRINS
 #include "grins/grins_solver.h"
+#include "grins/mesh_adaptivity_options.h"
+
+// libMesh
+#include "libmesh/error_estimator.h"
 
 namespace GRINS
 {
@@ -41,16 +45,88 @@ namespace GRINS
     UnsteadySolver( const GetPot& input );
     virtual ~UnsteadySolver();
 
+    virtual void initialize( const GetPot& input, 
+			     std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
+			     GRINS::MultiphysicsSystem* system );
+
     virtual void solve( SolverContext& context );
 
   protected:
 
     virtual void init_time_solver(GRINS::MultiphysicsSystem* system);
 
+    //! Applies the shrink limit and min/max bounds to a proposed time step
+    double bound_deltat( double proposed, double last_deltat ) const;
+
+    //! Shortens deltat so the step does not pass the next output time or the end time
+    double clip_deltat( double deltat, double time, double next_output_time ) const;
+
+    //! Report accepted and rejected time steps
+    void print_time_step_statistics() const;
+
+    //! Refine and coarsen the mesh from an error estimate of the current solution
+    /*! EquationSystems::reinit() projects every system vector, which
+	covers the old solutions of the time solvers and the interior_output
+	postprocessing system, and the refined mesh is repartitioned. */
+    void adapt_mesh( SolverContext& context );
+
+    //! Repartition if the measured assembly time is out of balance
+    /*! The imbalance is the largest assembly time of any processor over
+	the mean, measured since the last check. Above max_imbalance, the
+	WeightedPartitioner repartitions with the measured element times
+	as weights and the solution is moved to the new partition. */
+    void rebalance( SolverContext& context );
+
+    //! Time integrator: "euler" (theta method, default), "bdf2" or "sdirk2"
+    std::string _time_integrator;
+
+    //! Theta for the "euler" integrator
     double _theta;
     unsigned int _n_timesteps;
     double _deltat;
 
+    //! Stop once this time is reached. 0 means run n_timesteps steps.
+    double _end_time;
+
+    //! Physical time between visualization outputs. 0 means every step.
+    double _output_interval;
+
+    //! Number of times a step is retried with half the time step after a Newton failure
+    unsigned int _max_newton_failure_retries;
+
+    //! Error controlled time steps by step doubling (libMesh::TwostepTimeSolver)
+    bool _adaptive_time_stepping;
+
+    // Adaptive time stepping options
+    double _target_tolerance;
+    double _upper_tolerance;
+    double _max_growth;
+    double _max_shrink;
+    double _min_deltat;
+    double _max_deltat;
+
+    //! Whether some physics is operator split (Physics::has_split_time_step)
+    /*! If so, each step is Strang split: a half step of the split physics,
+	the global solve, then another half step of the split physics. */
+    bool _split_time_step;
+
+    //! Adapt the mesh every refine_interval time steps
+    bool _mesh_adaptive;
+    unsigned int _refine_interval;
+
+    std::tr1::shared_ptr<MeshAdaptivityOptions> _adaptivity_options;
+    std::tr1::shared_ptr<libMesh::ErrorEstimator> _error_estimator;
+
+    //! Check the load balance every rebalance_interval time steps, 0 never
+    unsigned int _rebalance_interval;
+    double _max_imbalance;
+
+    // Time step statistics
+    unsigned int _n_accepted_steps;
+    unsigned int _n_rejected_steps;
+    double _smallest_deltat;
+    double _largest_deltat;
+
   };
 
 } // end namespace GRINS
@@ -0,0 +1,84 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_JFNK_DIFF_SOLVER_H
+#define GRINS_JFNK_DIFF_SOLVER_H
+
+// C++
+#include <string>
+
+// libMesh
+#include "libmesh/libmesh_config.h"
+
+#ifdef LIBMESH_HAVE_PETSC
+
+#include "libmesh/petsc_diff_solver.h"
+
+namespace GRINS
+{
+  //! Jacobian-free Newton-Krylov solve through PETSc SNES
+  /*!
+    The Krylov solver applies the Jacobian by differencing residuals
+    (-snes_mf_operator) and the assembled system matrix is only used
+    to build the preconditioner, which is reassembled every
+    jacobian_lag Newton iterations (-snes_lag_jacobian). Both options
+    are given to this solver's SNES alone, through the options prefix
+    "jfnk_", so other PETSc solvers in the run are unaffected. Any
+    PETSc option for this solve takes the same prefix, e.g.
+    -jfnk_ksp_type gmres -jfnk_pc_type ilu, and options given on the
+    command line take precedence over the defaults set here.
+   */
+  class JFNKDiffSolver : public libMesh::PetscDiffSolver
+  {
+  public:
+
+    JFNKDiffSolver( sys_type& system, unsigned int jacobian_lag );
+    virtual ~JFNKDiffSolver();
+
+    //! Build the SNES and give it our options prefix and defaults
+    virtual void init();
+
+    //! Options prefix of the SNES, KSP and PC of this solver
+    static const std::string options_prefix;
+
+  protected:
+
+    //! Newton iterations between preconditioner matrix assemblies
+    unsigned int _jacobian_lag;
+
+    //! Set -<options_prefix><name> to value unless it is already set
+    void set_default_option( const std::string& name,
+			     const std::string& value ) const;
+
+  };
+
+} // end namespace GRINS
+
+#endif // LIBMESH_HAVE_PETSC
+
+#endif // GRINS_JFNK_DIFF_SOLVER_H
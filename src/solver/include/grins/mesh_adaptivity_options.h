@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_MESH_ADAPTIVITY_OPTIONS_H
+#define GRINS_MESH_ADAPTIVITY_OPTIONS_H
+
+// C++
+#include <string>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+// libMesh forward declarations
+class GetPot;
+
+namespace libMesh
+{
+  class ErrorVector;
+  class MeshRefinement;
+}
+
+namespace GRINS
+{
+  //! Refinement options from the mesh-adaptivity section
+  /*! Shared by the steady MeshAdaptiveSolver and the adaptive mode of
+      UnsteadySolver. */
+  class MeshAdaptivityOptions
+  {
+  public:
+
+    MeshAdaptivityOptions( const GetPot& input );
+    ~MeshAdaptivityOptions();
+
+    //! Set the refinement fractions, levels and targets on mesh_refinement
+    void set_refinement_options( libMesh::MeshRefinement& mesh_refinement ) const;
+
+    //! Flag elements with the chosen refinement_strategy
+    void flag_elements( libMesh::MeshRefinement& mesh_refinement,
+			const libMesh::ErrorVector& error ) const;
+
+  protected:
+
+    //! "error_fraction" (default), "elem_fraction" or "nelem_target"
+    std::string _refinement_strategy;
+
+    libMesh::Real _refine_fraction;
+    libMesh::Real _coarsen_fraction;
+    libMesh::Real _coarsen_threshold;
+
+    //! 0 leaves the refinement depth unlimited
+    unsigned int _max_h_level;
+
+    unsigned int _nelem_target;
+    bool _coarsen_by_parents;
+
+  private:
+
+    MeshAdaptivityOptions();
+
+  };
+} // namespace GRINS
+#endif // GRINS_MESH_ADAPTIVITY_OPTIONS_H
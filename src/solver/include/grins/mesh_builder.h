@@ -30,10 +30,12 @@
 #define GRINS_MESH_BUILDER_H
 
 // C++
+#include <string>
 #include "boost/tr1/memory.hpp"
 
 // libMesh
 #include "libmesh/mesh.h"
+#include "libmesh/unstructured_mesh.h"
 
 // libMesh forward declarations
 class GetPot;
@@ -47,14 +49,49 @@ namespace GRINS
 
     //! This Object handles building a libMesh::Mesh
     /*! Based on runtime input, either a generic 1, 2, or 3-dimensional
-        mesh is built; or is read from input from a specified file. */
+        mesh is built; or is read from input from a specified file.
+	mesh-options/mesh_class selects a replicated (serial) or a
+	distributed (parallel) mesh; the default is libMesh::Mesh. */
     MeshBuilder();
     ~MeshBuilder();
 
     void read_input_options( const GetPot& input );
 
     //! Builds the libMesh::Mesh according to input options.
-    std::tr1::shared_ptr<libMesh::Mesh> build(const GetPot& input );
+    /*! A distributed mesh keeps only the local elements and their ghosts
+	on each processor once it is prepared. Uniform refinement is done
+	after distribution, so only the local part is refined.
+
+	With mesh-options/coarse_generation_levels = n, a generated
+	distributed mesh is built with mesh_nx divided by up to 2^n (the
+	largest such power of two dividing all of them), then refined
+	back, so only that coarse mesh is ever replicated. This is off by
+	default: the coarsest level is then coarser than requested, which
+	mesh adaptivity may coarsen back to. Simplices refined this way are not split exactly
+	as build_square/build_cube would split them.
+
+	A distributed mesh read from a file is only read in parallel from
+	Nemesis files (mesh_filename ending in .nem or .n), split beforehand.
+	Any other format is read whole by every processor before being
+	distributed, so it does not reduce the startup memory. */
+    std::tr1::shared_ptr<libMesh::UnstructuredMesh> build(const GetPot& input );
+
+  protected:
+
+    //! Name of the mesh cache file for these options, empty if caching is off
+    /*! With mesh-options/mesh_cache, the built mesh is written to
+	mesh_cache_directory under a name hashed from every mesh-options
+	value, the size and time stamp of mesh_filename, and the number of
+	processors, so a change to any of them builds a new cache. */
+    std::string mesh_cache_filename( const GetPot& input ) const;
+
+    //! Read the mesh cache if there is one, with its partition
+    bool read_mesh_cache( libMesh::UnstructuredMesh& mesh,
+			  const std::string& filename ) const;
+
+    //! Write the built mesh, with one file per processor
+    void write_mesh_cache( libMesh::UnstructuredMesh& mesh,
+			   const std::string& filename ) const;
 
   };
 
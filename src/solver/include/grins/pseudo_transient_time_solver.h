@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+
+#ifndef GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
+#define GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
+
+// libMesh
+#include "libmesh/euler_solver.h"
+
+namespace GRINS
+{
+  //! Backward Euler in pseudo time, for pseudo-transient continuation
+  /*!
+    Each pseudo time step solves
+    \f[ M(u)(u - u_{old}) + \Delta \tau F(u) = 0 \f]
+    using the physics mass_residual terms, which damps the Newton steps
+    far from the steady solution. The pseudo time step is chosen by
+    SteadySolver. Since only the steady solution matters, is_steady()
+    returns true, so the physics use their steady forms (e.g. the
+    stabilization parameters have no time step term).
+
+    With set_pure_newton(true), the residual reduces to the steady
+    residual, as in libMesh::SteadySolver, both for the final Newton
+    solve and for measuring convergence.
+   */
+  class PseudoTransientTimeSolver : public libMesh::EulerSolver
+  {
+  public:
+
+    PseudoTransientTimeSolver( sys_type& system );
+    virtual ~PseudoTransientTimeSolver();
+
+    virtual bool element_residual( bool request_jacobian,
+				   libMesh::DiffContext& context );
+
+    virtual bool side_residual( bool request_jacobian,
+				libMesh::DiffContext& context );
+
+    virtual bool is_steady() const;
+
+    //! Drop the mass terms and assemble the steady residual
+    void set_pure_newton( bool pure_newton );
+
+    bool pure_newton() const;
+
+  protected:
+
+    //! Make the fixed solution the current one, as it is at steady state
+    void set_steady_fixed_solution( libMesh::DiffContext& context ) const;
+
+    bool _pure_newton;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_PSEUDO_TRANSIENT_TIME_SOLVER_H
@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_SDIRK2_TIME_SOLVER_H
+#define GRINS_SDIRK2_TIME_SOLVER_H
+
+// GRINS
+#include "grins/euler_stage_time_solver.h"
+
+namespace GRINS
+{
+  //! Two stage, second order, L-stable SDIRK scheme
+  /*!
+    Alexander's stiffly accurate scheme with
+    \f$ \gamma = 1 - 1/\sqrt{2} \f$. Both stages are backward Euler
+    solves with time step \f$ \gamma \Delta t \f$: the first from
+    \f$ u^n \f$, the second from
+    \f$ u^n + \frac{1-\gamma}{\gamma}(U_1 - u^n) \f$, which accounts for
+    the stage 1 time derivative through the stage 1 equation. Being a
+    one step method, it needs no history and can be used as the core of
+    an adaptive time solver.
+   */
+  class SDIRK2TimeSolver : public EulerStageTimeSolver
+  {
+  public:
+
+    SDIRK2TimeSolver( sys_type& system );
+    virtual ~SDIRK2TimeSolver();
+
+    virtual void solve();
+
+    virtual libMesh::Real error_order() const;
+
+  };
+
+} // end namespace GRINS
+
+#endif // GRINS_SDIRK2_TIME_SOLVER_H
@@ -30,6 +30,10 @@
 #define GRINS_SIMULATION_H
 
 // C++
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
 #include "boost/tr1/memory.hpp"
 
 // GRINS
@@ -37,7 +41,9 @@
 #include "grins/grins_solver.h"
 #include "grins/qoi_base.h"
 #include "grins/visualization.h"
+#include "grins/checkpoint.h"
 #include "grins/grins_physics_names.h"
+#include "grins/var_typedefs.h"
 #include "grins/nbc_container.h"
 #include "grins/dbc_container.h"
 #include "grins/postprocessed_quantities.h"
@@ -85,13 +91,38 @@ namespace GRINS
     
     void check_for_restart( const GetPot& input );
 
+    //! Attach the partitioner chosen by mesh-options/partitioner
+    /*! With 'weighted', the mesh is repartitioned right away using the
+	cost model of the physics, see Physics::element_cost(). */
+    void init_partitioner( const GetPot& input );
+
+    void read_continuation_options( const GetPot& input );
+
+    //! Steady solves while stepping one input parameter through a range
+    /*! Each solve starts from the previous solution, or from a secant
+	extrapolation of the last two. A failed solve is retried from the
+	last solution with half the step. With adaptive_step, the step is
+	scaled by target_nonlinear_iterations over the Newton iterations
+	of the last solve, by at most a factor of two either way. The
+	parameter value and QoIs are written after each solve. */
+    void run_continuation( SolverContext& context );
+
+    void read_stage_options( const GetPot& input );
+
+    //! Set up the system for one stage of a staged run
+    /*! Only the stage's physics are assembled, its frozen variables are
+	held at their current values and its parameters are set. Parameters
+	keep their values in later stages unless set again. The solution
+	carries over from the previous stage as the initial guess. */
+    void apply_stage( unsigned int stage );
+
     void attach_neumann_bc_funcs( std::map< GRINS::PhysicsName, GRINS::NBCContainer > neumann_bcs,
 				  GRINS::MultiphysicsSystem* system );
     
     void attach_dirichlet_bc_funcs( std::multimap< GRINS::PhysicsName, GRINS::DBCContainer > dbc_map,
 				    GRINS::MultiphysicsSystem* system );
 
-    std::tr1::shared_ptr<libMesh::Mesh> _mesh;
+    std::tr1::shared_ptr<libMesh::UnstructuredMesh> _mesh;
 
     std::tr1::shared_ptr<libMesh::EquationSystems> _equation_system;
 
@@ -108,6 +139,8 @@ namespace GRINS
 
     std::tr1::shared_ptr<PostProcessedQuantities<Real> > _postprocessing;
 
+    std::tr1::shared_ptr<GRINS::Checkpoint> _checkpoint;
+
     // Screen display options
     bool _print_mesh_info;
     bool _print_log_info;
@@ -118,6 +151,24 @@ namespace GRINS
     bool _output_vis;
     bool _output_residual;
 
+    // Continuation options, see run_continuation()
+    std::string _continuation_parameter;
+    Real _continuation_initial_value;
+    Real _continuation_final_value;
+    Real _continuation_initial_step;
+    Real _continuation_min_step;
+    Real _continuation_max_step;
+    std::string _continuation_predictor;
+    bool _continuation_adaptive_step;
+    unsigned int _continuation_target_iterations;
+    std::string _continuation_qoi_file;
+
+    // Staged run options, see apply_stage()
+    std::vector<std::string> _stage_names;
+    std::vector<std::set<PhysicsName> > _stage_physics;
+    std::vector<std::vector<VariableIndex> > _stage_frozen_variables;
+    std::vector<std::vector<std::pair<std::string,Real> > > _stage_parameters;
+
   private:
 
     Simulation();
@@ -36,6 +36,7 @@
 
 // GRINS
 #include "grins/visualization.h"
+#include "grins/checkpoint.h"
 #include "grins/postprocessed_quantities.h"
 
 namespace GRINS
@@ -63,6 +64,9 @@ namespace GRINS
 
     std::tr1::shared_ptr<PostProcessedQuantities<Real> > postprocessing;
 
+    //! Restart checkpoints, NULL if none were requested
+    std::tr1::shared_ptr<GRINS::Checkpoint> checkpoint;
+
   };
 
 } // end namespace GRINS
@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_WEIGHTED_PARTITIONER_H
+#define GRINS_WEIGHTED_PARTITIONER_H
+
+// C++
+#include <map>
+#include <vector>
+
+// libMesh
+#include "libmesh/id_types.h"
+#include "libmesh/partitioner.h"
+#include "libmesh/point.h"
+
+namespace GRINS
+{
+  //! Partitions the mesh so that every processor gets the same total element weight
+  /*! Recursive coordinate bisection of the active element centroids:
+      each cut is along the longest side of the bounding box, at the
+      point where the weight on each side is proportional to the number
+      of processors it goes to. Each processor gives the weights of its
+      own active elements, by element id, typically measured assembly
+      times, see MultiphysicsSystem::element_cost_weights(); they are
+      gathered on every processor when partitioning. Without weights,
+      every element weighs the same.
+
+      Every processor computes the whole partition, so the mesh must be
+      replicated; a distributed mesh is rejected. */
+  class WeightedPartitioner : public libMesh::Partitioner
+  {
+  public:
+
+    WeightedPartitioner();
+    virtual ~WeightedPartitioner();
+
+    virtual libMesh::AutoPtr<libMesh::Partitioner> clone() const;
+
+    //! Weights of this processor's active elements for the next partition
+    void set_weights( const std::map<libMesh::dof_id_type,libMesh::Real>& weights );
+
+  protected:
+
+    virtual void _do_partition( libMesh::MeshBase& mesh,
+				const unsigned int n );
+
+    //! Active element with the data the bisection sorts by
+    struct WeightedElem
+    {
+      libMesh::Elem* elem;
+      libMesh::Point centroid;
+      libMesh::Real weight;
+    };
+
+    //! Split elems [begin,end) among processors first_pid, ..., first_pid+n_parts-1
+    void bisect( std::vector<WeightedElem>& elems,
+		 unsigned int begin, unsigned int end,
+		 unsigned int first_pid, unsigned int n_parts ) const;
+
+    std::map<libMesh::dof_id_type,libMesh::Real> _weights;
+
+  };
+} // namespace GRINS
+#endif // GRINS_WEIGHTED_PARTITIONER_H
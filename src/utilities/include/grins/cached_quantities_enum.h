@@ -67,7 +67,28 @@ namespace GRINS
 			   DIFFUSION_COEFFS,
 			   SPECIES_ENTHALPY,
 			   SPECIES_NORMALIZED_ENTHALPY_MINUS_NORMALIZED_ENTROPY,
-			   OMEGA_DOT };
+			   OMEGA_DOT,
+			   /* Derivatives w.r.t. T and mass fractions at fixed thermodynamic
+			      pressure, only filled when the physics assembles its own Jacobian.
+			      _DY quantities of a scalar have one entry per species. _DY
+			      quantities of a species quantity store d(q_s)/d(Y_k) as
+			      species index s*n_species+k. */
+			   MIXTURE_VISCOSITY_DT,
+			   MIXTURE_VISCOSITY_DY,
+			   MIXTURE_THERMAL_CONDUCTIVITY_DT,
+			   MIXTURE_THERMAL_CONDUCTIVITY_DY,
+			   MIXTURE_SPECIFIC_HEAT_P_DT,
+			   MIXTURE_SPECIFIC_HEAT_P_DY,
+			   SPECIES_ENTHALPY_DT,
+			   DIFFUSION_COEFFS_DT,
+			   DIFFUSION_COEFFS_DY,
+			   OMEGA_DOT_DT,
+			   OMEGA_DOT_DY,
+			   //! Number of cached quantities. Must remain the last entry.
+			   N_CACHED_QUANTITIES };
+
+    //! Name of a CachedQuantities value, e.g. "OMEGA_DOT", for diagnostics
+    const char* quantity_name( unsigned int quantity );
   } // namespace Cache
 } // namespace GRINS
 
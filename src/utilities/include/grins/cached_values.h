@@ -32,7 +32,6 @@
 //C++
 #include <set>
 #include <vector>
-#include <map>
 
 // libMesh
 #include "libmesh/libmesh.h"
@@ -40,9 +39,28 @@
 
 // GRINS
 #include "grins/cached_quantities_enum.h"
+#include "grins/species_block.h"
 
 namespace GRINS
 {
+  //! Per-quadrature-point storage of quantities shared between physics
+  /*!
+    Storage is a dense array indexed by Cache::CachedQuantities. Each
+    entry holds contiguous per-qp data that is sized the first time it
+    is set and then reused: clear() only marks quantities as unset so
+    that an instance owned by a thread (see AssemblyContext) can be
+    reset between elements without freeing memory. The prepare_* methods
+    return the storage for a quantity, resized to the requested number
+    of points, so that physics can fill it in place rather than copying
+    in temporary vectors. Species-indexed (vector) quantities are held
+    in a SpeciesBlock, one contiguous allocation per quantity, in either
+    qp-major or species-major layout.
+
+    Only quantities marked active through add_quantity() need to be
+    computed; producers check is_active() before filling optional ones.
+    With set_track_reads(true), the cache also counts quantities that
+    were set for an element but never read before the next clear().
+   */
   class CachedValues
   {
   public:
@@ -54,9 +72,21 @@ namespace GRINS
 
     void add_quantities( const std::set<unsigned int>& cache_list );
 
+    //! Make exactly the quantities in cache_list active
+    void set_quantities( const std::set<unsigned int>& cache_list );
+
+    //! Marks all cached values as unset. Allocated storage is retained.
     void clear();
 
-    bool is_active(unsigned int quantity);
+    bool is_active(unsigned int quantity) const;
+
+    //! Count quantities that are set but never read between calls to clear()
+    void set_track_reads( bool track_reads );
+
+    //! Number of elements for which each quantity was set but never read
+    /*! Only counted while read tracking is on. Quantities set since the
+	last clear() are not included until clear() is called again. */
+    const std::vector<unsigned int>& n_unread() const;
 
     void set_values( unsigned int quantity, std::vector<libMesh::Number>& values );
 
@@ -69,25 +99,101 @@ namespace GRINS
     void set_vector_gradient_values( unsigned int quantity,
 				     std::vector<std::vector<libMesh::Gradient> >& values );
 
+    //! Returns storage for quantity, sized to n_points, to be filled in place.
+    std::vector<libMesh::Number>& prepare_values( unsigned int quantity,
+                                                  unsigned int n_points );
+
+    //! Returns storage for quantity, sized to n_points, to be filled in place.
+    std::vector<libMesh::Gradient>& prepare_gradient_values( unsigned int quantity,
+                                                             unsigned int n_points );
+
+    //! Returns storage for quantity, sized to n_points x n_species, to be filled in place.
+    SpeciesBlock<libMesh::Number>& prepare_vector_values( unsigned int quantity,
+                                                          unsigned int n_points,
+                                                          unsigned int n_species,
+                                                          Cache::SpeciesLayout layout = Cache::QP_MAJOR );
+
+    //! Returns storage for quantity, sized to n_points x n_species, to be filled in place.
+    SpeciesBlock<libMesh::Gradient>& prepare_vector_gradient_values( unsigned int quantity,
+                                                                     unsigned int n_points,
+                                                                     unsigned int n_species,
+                                                                     Cache::SpeciesLayout layout = Cache::QP_MAJOR );
+
     const std::vector<libMesh::Number>& get_cached_values( unsigned int quantity ) const;
     
     const std::vector<libMesh::Gradient>& get_cached_gradient_values( unsigned int quantity ) const;
 
-    const std::vector<std::vector<libMesh::Number> >& get_cached_vector_values( unsigned int quantity ) const;
+    const SpeciesBlock<libMesh::Number>& get_cached_vector_values( unsigned int quantity ) const;
 
-    const std::vector<std::vector<libMesh::Gradient> >& get_cached_vector_gradient_values( unsigned int quantity ) const;
+    const SpeciesBlock<libMesh::Gradient>& get_cached_vector_gradient_values( unsigned int quantity ) const;
 
   protected:
     
-    std::set<unsigned int> _cache_list;
+    //! Whether each quantity has been requested through add_quantity
+    std::vector<bool> _cache_list;
+
+    std::vector<std::vector<libMesh::Number> > _cached_values;
+    std::vector<std::vector<libMesh::Gradient> > _cached_gradient_values;
+    std::vector<SpeciesBlock<libMesh::Number> > _cached_vector_values;
+    std::vector<SpeciesBlock<libMesh::Gradient> > _cached_vector_gradient_values;
+
+    //! Whether each quantity has been set since the last clear()
+    std::vector<bool> _values_set;
+    std::vector<bool> _gradient_values_set;
+    std::vector<bool> _vector_values_set;
+    std::vector<bool> _vector_gradient_values_set;
 
-    std::map<unsigned int,std::vector<libMesh::Number> > _cached_values;
-    std::map<unsigned int,std::vector<libMesh::Gradient> > _cached_gradient_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Number> >  > _cached_vector_values;
-    std::map<unsigned int,std::vector<std::vector<libMesh::Gradient> >  > _cached_vector_gradient_values;
+    bool _track_reads;
+
+    //! Whether each quantity has been read since the last clear(), if tracking
+    mutable std::vector<bool> _values_read;
+
+    std::vector<unsigned int> _n_unread;
     
   };
 
+  inline
+  const std::vector<unsigned int>& CachedValues::n_unread() const
+  {
+    return _n_unread;
+  }
+
+  inline
+  const std::vector<libMesh::Number>& CachedValues::get_cached_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _values_set[quantity] );
+    if( _track_reads ) _values_read[quantity] = true;
+    return _cached_values[quantity];
+  }
+
+  inline
+  const std::vector<libMesh::Gradient>& CachedValues::get_cached_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _gradient_values_set[quantity] );
+    if( _track_reads ) _values_read[quantity] = true;
+    return _cached_gradient_values[quantity];
+  }
+
+  inline
+  const SpeciesBlock<libMesh::Number>& CachedValues::get_cached_vector_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _vector_values_set[quantity] );
+    if( _track_reads ) _values_read[quantity] = true;
+    return _cached_vector_values[quantity];
+  }
+
+  inline
+  const SpeciesBlock<libMesh::Gradient>& CachedValues::get_cached_vector_gradient_values( unsigned int quantity ) const
+  {
+    libmesh_assert_less( quantity, Cache::N_CACHED_QUANTITIES );
+    libmesh_assert( _vector_gradient_values_set[quantity] );
+    if( _track_reads ) _values_read[quantity] = true;
+    return _cached_vector_gradient_values[quantity];
+  }
+
 } // namespace GRINS
 
 #endif // GRINS_CACHED_VALUES_H
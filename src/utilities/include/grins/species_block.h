@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------bl-
+//--------------------------------------------------------------------------
+// 
+// GRINS - General Reacting Incompressible Navier-Stokes 
+//
+// Copyright (C) 2010-2013 The PECOS Development Team
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the Version 2.1 GNU Lesser General
+// Public License as published by the Free Software Foundation.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc. 51 Franklin Street, Fifth Floor,
+// Boston, MA  02110-1301  USA
+//
+//-----------------------------------------------------------------------el-
+//
+// $Id$
+//
+//--------------------------------------------------------------------------
+//--------------------------------------------------------------------------
+
+#ifndef GRINS_SPECIES_BLOCK_H
+#define GRINS_SPECIES_BLOCK_H
+
+// C++
+#include <vector>
+
+// libMesh
+#include "libmesh/libmesh_common.h"
+
+namespace GRINS
+{
+  namespace Cache
+  {
+    //! Memory layout of a SpeciesBlock
+    /*! QP_MAJOR stores all species of one quadrature point contiguously,
+        which suits per-qp species loops in assembly. SPECIES_MAJOR stores
+        all quadrature points of one species contiguously, which suits
+        loops over quadrature points for a fixed species. */
+    enum SpeciesLayout{ QP_MAJOR = 0,
+                        SPECIES_MAJOR };
+  } // namespace Cache
+
+  //! Contiguous n_points x n_species storage for species-indexed cached quantities
+  /*!
+    All values live in a single allocation. Resizing to the same or a
+    smaller size does not reallocate, so a block held by a reused
+    CachedValues object costs no heap traffic after the first element.
+   */
+  template<typename T>
+  class SpeciesBlock
+  {
+  public:
+
+    SpeciesBlock();
+    ~SpeciesBlock();
+
+    void resize( unsigned int n_points, unsigned int n_species,
+                 Cache::SpeciesLayout layout = Cache::QP_MAJOR );
+
+    unsigned int n_points() const;
+
+    unsigned int n_species() const;
+
+    Cache::SpeciesLayout layout() const;
+
+    T& operator()( unsigned int qp, unsigned int species );
+
+    const T& operator()( unsigned int qp, unsigned int species ) const;
+
+    //! Stride between consecutive species of one quadrature point
+    unsigned int species_stride() const;
+
+    //! Stride between consecutive quadrature points of one species
+    unsigned int qp_stride() const;
+
+    //! Pointer to the species values at qp. Contiguous only for QP_MAJOR.
+    const T* qp_data( unsigned int qp ) const;
+
+    T* qp_data( unsigned int qp );
+
+    //! Pointer to the values of species at all qps. Contiguous only for SPECIES_MAJOR.
+    const T* species_data( unsigned int species ) const;
+
+    T* species_data( unsigned int species );
+
+    //! Copies the species values at qp into values, which is resized as needed
+    void get_qp_values( unsigned int qp, std::vector<T>& values ) const;
+
+    //! Copies values into the species entries at qp
+    void set_qp_values( unsigned int qp, const std::vector<T>& values );
+
+  protected:
+
+    unsigned int index( unsigned int qp, unsigned int species ) const;
+
+    std::vector<T> _data;
+
+    unsigned int _n_points;
+
+    unsigned int _n_species;
+
+    Cache::SpeciesLayout _layout;
+
+  };
+
+  /* ------------------------- Inline Functions -------------------------*/
+
+  template<typename T>
+  inline
+  SpeciesBlock<T>::SpeciesBlock()
+    : _n_points(0),
+      _n_species(0),
+      _layout(Cache::QP_MAJOR)
+  {
+    return;
+  }
+
+  template<typename T>
+  inline
+  SpeciesBlock<T>::~SpeciesBlock()
+  {
+    return;
+  }
+
+  template<typename T>
+  inline
+  void SpeciesBlock<T>::resize( unsigned int n_points, unsigned int n_species,
+                                Cache::SpeciesLayout layout )
+  {
+    _n_points = n_points;
+    _n_species = n_species;
+    _layout = layout;
+    _data.resize( n_points*n_species );
+    return;
+  }
+
+  template<typename T>
+  inline
+  unsigned int SpeciesBlock<T>::n_points() const
+  {
+    return _n_points;
+  }
+
+  template<typename T>
+  inline
+  unsigned int SpeciesBlock<T>::n_species() const
+  {
+    return _n_species;
+  }
+
+  template<typename T>
+  inline
+  Cache::SpeciesLayout SpeciesBlock<T>::layout() const
+  {
+    return _layout;
+  }
+
+  template<typename T>
+  inline
+  unsigned int SpeciesBlock<T>::index( unsigned int qp, unsigned int species ) const
+  {
+    libmesh_assert_less( qp, _n_points );
+    libmesh_assert_less( species, _n_species );
+
+    return (_layout == Cache::QP_MAJOR) ? qp*_n_species + species : species*_n_points + qp;
+  }
+
+  template<typename T>
+  inline
+  T& SpeciesBlock<T>::operator()( unsigned int qp, unsigned int species )
+  {
+    return _data[this->index(qp,species)];
+  }
+
+  template<typename T>
+  inline
+  const T& SpeciesBlock<T>::operator()( unsigned int qp, unsigned int species ) const
+  {
+    return _data[this->index(qp,species)];
+  }
+
+  template<typename T>
+  inline
+  unsigned int SpeciesBlock<T>::species_stride() const
+  {
+    return (_layout == Cache::QP_MAJOR) ? 1 : _n_points;
+  }
+
+  template<typename T>
+  inline
+  unsigned int SpeciesBlock<T>::qp_stride() const
+  {
+    return (_layout == Cache::QP_MAJOR) ? _n_species : 1;
+  }
+
+  template<typename T>
+  inline
+  const T* SpeciesBlock<T>::qp_data( unsigned int qp ) const
+  {
+    libmesh_assert_equal_to( _layout, Cache::QP_MAJOR );
+    return &_data[this->index(qp,0)];
+  }
+
+  template<typename T>
+  inline
+  T* SpeciesBlock<T>::qp_data( unsigned int qp )
+  {
+    libmesh_assert_equal_to( _layout, Cache::QP_MAJOR );
+    return &_data[this->index(qp,0)];
+  }
+
+  template<typename T>
+  inline
+  const T* SpeciesBlock<T>::species_data( unsigned int species ) const
+  {
+    libmesh_assert_equal_to( _layout, Cache::SPECIES_MAJOR );
+    return &_data[this->index(0,species)];
+  }
+
+  template<typename T>
+  inline
+  T* SpeciesBlock<T>::species_data( unsigned int species )
+  {
+    libmesh_assert_equal_to( _layout, Cache::SPECIES_MAJOR );
+    return &_data[this->index(0,species)];
+  }
+
+  template<typename T>
+  inline
+  void SpeciesBlock<T>::get_qp_values( unsigned int qp, std::vector<T>& values ) const
+  {
+    values.resize(_n_species);
+
+    const unsigned int stride = this->species_stride();
+    const T* data = &_data[this->index(qp,0)];
+
+    for( unsigned int s = 0; s < _n_species; s++ )
+      {
+        values[s] = data[s*stride];
+      }
+
+    return;
+  }
+
+  template<typename T>
+  inline
+  void SpeciesBlock<T>::set_qp_values( unsigned int qp, const std::vector<T>& values )
+  {
+    libmesh_assert_equal_to( values.size(), _n_species );
+
+    const unsigned int stride = this->species_stride();
+    T* data = &_data[this->index(qp,0)];
+
+    for( unsigned int s = 0; s < _n_species; s++ )
+      {
+        data[s*stride] = values[s];
+      }
+
+    return;
+  }
+
+} // namespace GRINS
+
+#endif // GRINS_SPECIES_BLOCK_H
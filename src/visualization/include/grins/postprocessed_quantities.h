@@ -29,6 +29,9 @@
 #ifndef GRINS_POSTPROCESSED_QUANTITIES_H
 #define GRINS_POSTPROCESSED_QUANTITIES_H
 
+//C++
+#include <set>
+
 //libMesh
 #include "libmesh/getpot.h"
 #include "libmesh/fem_function_base.h"
@@ -73,6 +76,12 @@ namespace GRINS
 
     virtual void update_quantities( libMesh::EquationSystems& equation_systems );
 
+    //! Register the cached quantities needed for the requested output_vars
+    /*! Called once by initialize(), after init_quantities(), to activate
+	quantities in the cache passed to MultiphysicsSystem::compute_element_cache.
+	Subclasses computing extra quantities from the cache add them here. */
+    virtual void register_cache_quantities( std::set<unsigned int>& element_quantities ) const;
+
     unsigned int n_quantities() const
     {return _quantities.size();}
 
@@ -95,6 +104,9 @@ namespace GRINS
 
     CachedValues _cache;
 
+    //! Cached quantities needed by the requested output_vars, see init_quantities
+    std::set<unsigned int> _cache_quantities;
+
     libMesh::Point _prev_point;
 
     //! Place to cache species names for species-dependent quantities.
@@ -30,6 +30,8 @@
 #define GRINS_VISUALIZATION_H
 
 // C++
+#include <deque>
+#include <map>
 #include <string>
 #include <vector>
 #include "boost/tr1/memory.hpp"
@@ -40,6 +42,11 @@
 // libMesh forward declarations
 class GetPot;
 
+namespace libMesh
+{
+  class ExodusII_IO;
+}
+
 namespace GRINS
 {
   // Forward declarations
@@ -63,14 +70,92 @@ namespace GRINS
 				  GRINS::MultiphysicsSystem* system,
 				  const unsigned int time_step, const libMesh::Real time ) =0;
 
+    //! Write every output format
+    /*! With vis-options/async_output, the tecplot, tecplot_binary and
+	gmv formats are written from a copy of the solution by a
+	background thread on processor 0, so the solve goes on meanwhile.
+	At most max_pending_outputs copies are kept; once there are that
+	many, this waits for the oldest to be written. The other formats,
+	distributed meshes, and runs with libMesh logging enabled (the
+	performance log is not thread safe) are written right away.
+
+	With vis-options/exodus_time_series, ExodusII output with a
+	series_name is appended as the next time step of series_name.exo
+	instead of going to its own file, so the mesh is only written once.
+	After mesh_changed(), the series goes on in series_name.exo-s.0001
+	and so on, which ParaView reads as one series. */
     void dump_visualization( std::tr1::shared_ptr<libMesh::EquationSystems> equation_system,
-			     const std::string& filename_prefix, const libMesh::Real time );
+			     const std::string& filename_prefix, const libMesh::Real time,
+			     const std::string& series_name = "" );
+
+    //! Wait until every background output is written
+    /*! Must be called before the mesh is changed. */
+    void wait_for_output();
+
+    //! Tell the output that the mesh was refined, coarsened or repartitioned
+    /*! Open ExodusII series are closed and go on in a new file. */
+    void mesh_changed();
     
   protected:
 
+    //! One copy of the solution and the files to write from it
+    struct OutputJob
+    {
+      const libMesh::MeshBase* mesh;
+      std::vector<libMesh::Number> solution;
+      std::vector<std::string> names;
+      std::string filename_prefix;
+      std::vector<std::string> formats;
+    };
+
+    //! Whether format can be written in the background
+    static bool is_async_format( const std::string& format );
+
+    //! Hand a job to the writer thread, waiting if too many are pending
+    void queue_output( OutputJob* job );
+
+    //! Body of the writer thread
+    static void* writer_loop( void* visualization );
+
+    void write_job( const OutputJob& job ) const;
+
+    //! An ExodusII file that stays open for the next time step
+    struct ExodusSeries
+    {
+      ExodusSeries() : step(0), n_files(0) {}
+
+      std::tr1::shared_ptr<libMesh::ExodusII_IO> io;
+      std::string filename;
+      int step;
+      unsigned int n_files;
+    };
+
+    //! Append a time step to the ExodusII series series_name
+    void write_exodus_series( libMesh::EquationSystems& equation_system,
+			      const std::string& series_name, const libMesh::Real time );
+
     // Visualization options
     std::string _vis_output_file_prefix;
     std::vector<std::string> _output_format;
+
+    //! Append ExodusII output to one file per series
+    bool _exodus_time_series;
+    std::map<std::string, ExodusSeries> _exodus_series;
+
+    // Background output
+    bool _async_output;
+    unsigned int _max_pending_outputs;
+
+    //! Jobs not yet written, oldest first, including the one being written
+    std::deque<OutputJob*> _output_queue;
+
+    bool _writer_started;
+    bool _writer_stop;
+
+    //! The writer thread and the lock and condition guarding the queue
+    /*! Defined in visualization.C, so this header does not need pthread.h. */
+    struct WriterThread;
+    WriterThread* _writer;
   };
 }// namespace GRINS
 #endif // GRINS_VISUALIZATION_H